@@ -0,0 +1,501 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2026 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   Logger.cpp
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+
+#include <jaut_logger/jaut_logger.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+
+//======================================================================================================================
+namespace
+{
+    /** The amount of messages each run logs, formats or prints, spread over all producers. */
+    constexpr std::int64_t default_num_messages = 1'000'000;
+    
+    /** The number of messages a sink gets between two flushes, like a worker would hand them in. */
+    constexpr int sink_batch_size = 512;
+    
+    /** The producer counts the loggers that allow logging from several threads are measured with. */
+    constexpr int producer_counts[] { 1, 2, 4, 8, 16, 32, 64 };
+    
+    //==================================================================================================================
+    using Clock = std::chrono::steady_clock;
+    
+    //==================================================================================================================
+    /** The command line options of the benchmark. */
+    struct Settings
+    {
+        /** The amount of messages per run. */
+        std::int64_t numMessages = default_num_messages;
+        
+        /** The directory the file sinks write to, this should be a tmpfs to measure the sinks and not the disk. */
+        juce::File directory;
+        
+        /** The file the results should be written to, if this is not a file they will be written to stdout. */
+        juce::File output;
+    };
+    
+    //==================================================================================================================
+    /** A sink that only counts what it gets, so that the loggers can be measured without any I/O. */
+    class NullSink : public jaut::ILogSink
+    {
+    public:
+        explicit NullSink(std::atomic<std::int64_t> &parReceived) noexcept
+            : received(parReceived)
+        {}
+        
+        //==============================================================================================================
+        void print(const jaut::LogMessage&) override
+        {
+            received.fetch_add(1, std::memory_order_relaxed);
+        }
+        
+        JAUT_NODISCARD
+        const jaut::ILogFormat* getFormatter() const override
+        {
+            return nullptr;
+        }
+    
+    private:
+        std::atomic<std::int64_t> &received;
+    };
+    
+    //==================================================================================================================
+    /**
+     *  Creates a message that looks like what a logger would create, with a field attached to it.
+     *  
+     *  @param index The index of the message, to make messages differ
+     *  @return The message
+     */
+    jaut::LogMessage makeMessage(std::int64_t index)
+    {
+        jaut::LogMessage message;
+        message.name       = "benchmark";
+        message.threadName = "producer";
+        message.threadId   = std::this_thread::get_id();
+        message.timestamp  = juce::Time::getCurrentTime();
+        message.level      = jaut::LogLevel::Info;
+        message.message    = "Benchmark message number " + juce::String(static_cast<juce::int64>(index)) + " with some payload";
+        message.fields.push_back(jaut::mfield("index", static_cast<juce::int64>(index)));
+        
+        return message;
+    }
+    
+    /**
+     *  Gets the given percentile of a list of samples.
+     *  
+     *  @param samples    The samples, these will be reordered
+     *  @param percentile The percentile between 0 and 1
+     *  @return The sample at the percentile
+     */
+    std::int64_t getPercentile(std::vector<std::int64_t> &samples, double percentile)
+    {
+        if (samples.empty())
+        {
+            return 0;
+        }
+        
+        const auto index = static_cast<std::size_t>(percentile * static_cast<double>(samples.size() - 1));
+        std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(index), samples.end());
+        
+        return samples[index];
+    }
+    
+    //==================================================================================================================
+    /**
+     *  Measures how many messages per second a logger can take from the given number of producers, until all of
+     *  them have reached the sink, and how long a single call to the logger takes on the producer thread.
+     *  
+     *  @param name        The name of the logger type for the results
+     *  @param numThreads  The number of producer threads
+     *  @param numMessages The amount of messages all producers log together
+     *  @return The results of this run
+     */
+    template<class Logger>
+    juce::var measureLogger(const char *name, int numThreads, std::int64_t numMessages)
+    {
+        std::atomic<std::int64_t>              received { 0 };
+        std::vector<std::vector<std::int64_t>> latencies(static_cast<std::size_t>(numThreads));
+        
+        const std::int64_t per_thread = (numMessages / numThreads);
+        Clock::time_point  start;
+        
+        {
+            typename Logger::Options options;
+            options.logLevel                                = jaut::LogLevel::Info;
+            options.overflowPolicySettings.policy           = jaut::OverflowPolicy::Block;
+            options.flushPolicySettings.flushOnFinalisation = true;
+            options.flushPolicySettings.policies.reset();
+            options.flushPolicySettings.policies.set(jaut::FlushPolicy::Filled);
+            
+            Logger logger("BENCHMARK", std::move(options), std::make_unique<NullSink>(received));
+            
+            std::atomic<int>         ready { 0 };
+            std::atomic<bool>        go    { false };
+            std::vector<std::thread> producers;
+            
+            for (int p = 0; p < numThreads; ++p)
+            {
+                producers.emplace_back([&logger, &ready, &go, &samples = latencies[static_cast<std::size_t>(p)],
+                                        per_thread, p]()
+                {
+                    samples.reserve(static_cast<std::size_t>(per_thread));
+                    
+                    ready.fetch_add(1);
+                    
+                    while (!go.load(std::memory_order_acquire))
+                    {
+                        std::this_thread::yield();
+                    }
+                    
+                    for (std::int64_t i = 0; i < per_thread; ++i)
+                    {
+                        const Clock::time_point call_start = Clock::now();
+                        logger.info("Benchmark message number {} from producer {}", i, p);
+                        
+                        samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now()
+                                                                                                   - call_start)
+                                              .count());
+                    }
+                });
+            }
+            
+            while (ready.load() < numThreads)
+            {
+                std::this_thread::yield();
+            }
+            
+            start = Clock::now();
+            go.store(true, std::memory_order_release);
+            
+            for (std::thread &producer : producers)
+            {
+                producer.join();
+            }
+            
+            // Destroying the logger drains whatever is left, so the time includes everything up to the sink
+        }
+        
+        const std::chrono::duration<double> elapsed = Clock::now() - start;
+        
+        std::vector<std::int64_t> samples;
+        samples.reserve(static_cast<std::size_t>(per_thread * numThreads));
+        
+        for (const std::vector<std::int64_t> &thread_samples : latencies)
+        {
+            samples.insert(samples.end(), thread_samples.begin(), thread_samples.end());
+        }
+        
+        const std::int64_t logged = (per_thread * numThreads);
+        
+        if (received.load() != logged)
+        {
+            std::fprintf(stderr, "%s lost %lld of %lld messages\n", name,
+                         static_cast<long long>(logged - received.load()), static_cast<long long>(logged));
+        }
+        
+        const auto p50 = static_cast<juce::int64>(getPercentile(samples, 0.5));
+        const auto p99 = static_cast<juce::int64>(getPercentile(samples, 0.99));
+        
+        const double messages_per_second = (static_cast<double>(received.load()) / elapsed.count());
+        
+        auto *latency = new juce::DynamicObject();
+        latency->setProperty("p50",  p50);
+        latency->setProperty("p90",  static_cast<juce::int64>(getPercentile(samples, 0.9)));
+        latency->setProperty("p99",  p99);
+        latency->setProperty("p999", static_cast<juce::int64>(getPercentile(samples, 0.999)));
+        latency->setProperty("max",  static_cast<juce::int64>(getPercentile(samples, 1.0)));
+        
+        auto *result = new juce::DynamicObject();
+        result->setProperty("logger",            name);
+        result->setProperty("producers",         numThreads);
+        result->setProperty("messages",          static_cast<juce::int64>(logged));
+        result->setProperty("received",          static_cast<juce::int64>(received.load()));
+        result->setProperty("messagesPerSecond", messages_per_second);
+        result->setProperty("latencyNs",         latency);
+        
+        std::fprintf(stderr, "%-24s %3d producers %14.0f msg/s  p50 %6lld ns  p99 %8lld ns\n", name, numThreads,
+                     messages_per_second, static_cast<long long>(p50), static_cast<long long>(p99));
+        
+        return result;
+    }
+    
+    /**
+     *  Measures a logger type with every producer count, or only one if it doesn't allow several producers.
+     *  
+     *  @param results     The list to add the results to
+     *  @param name        The name of the logger type for the results
+     *  @param numMessages The amount of messages per run
+     *  @param multiThread Whether the logger allows logging from several threads
+     */
+    template<class Logger>
+    void runLogger(juce::Array<juce::var> &results, const char *name, std::int64_t numMessages, bool multiThread)
+    {
+        for (const int num_threads : producer_counts)
+        {
+            if (!multiThread && num_threads > 1)
+            {
+                break;
+            }
+            
+            results.add(measureLogger<Logger>(name, num_threads, numMessages));
+        }
+    }
+    
+    //==================================================================================================================
+    /**
+     *  Measures how long a formatter takes to render a single message.
+     *  
+     *  @param name        The name of the formatter for the results
+     *  @param formatter   The formatter to measure
+     *  @param numMessages The amount of messages to render
+     *  @return The results of this run
+     */
+    juce::var measureFormatter(const char *name, const jaut::ILogFormat &formatter, std::int64_t numMessages)
+    {
+        // Messages are created up front, this should only measure rendering them
+        std::vector<jaut::LogMessage> messages;
+        messages.reserve(sink_batch_size);
+        
+        for (int i = 0; i < sink_batch_size; ++i)
+        {
+            messages.push_back(makeMessage(i));
+        }
+        
+        fmt::memory_buffer buffer;
+        std::int64_t       bytes = 0;
+        
+        const Clock::time_point start = Clock::now();
+        
+        for (std::int64_t i = 0; i < numMessages; ++i)
+        {
+            buffer.clear();
+            formatter.formatTo(buffer, messages[static_cast<std::size_t>(i % sink_batch_size)]);
+            bytes += static_cast<std::int64_t>(buffer.size());
+        }
+        
+        const std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+        
+        auto *result = new juce::DynamicObject();
+        result->setProperty("formatter",       name);
+        result->setProperty("messages",        static_cast<juce::int64>(numMessages));
+        result->setProperty("nsPerMessage",    elapsed.count() / static_cast<double>(numMessages));
+        result->setProperty("bytesPerMessage", static_cast<double>(bytes) / static_cast<double>(numMessages));
+        
+        std::fprintf(stderr, "%-24s %14.1f ns/msg\n", name, elapsed.count() / static_cast<double>(numMessages));
+        
+        return result;
+    }
+    
+    //==================================================================================================================
+    /**
+     *  Measures how many messages per second a sink can write, it gets them in batches just like from a worker.
+     *  
+     *  @param name        The name of the sink for the results
+     *  @param sink        The sink to measure
+     *  @param logFile     The file the sink writes to
+     *  @param numMessages The amount of messages to write
+     *  @return The results of this run
+     */
+    juce::var measureSink(const char *name, jaut::ILogSink &sink, const juce::File &logFile, std::int64_t numMessages)
+    {
+        std::vector<jaut::LogMessage> messages;
+        messages.reserve(sink_batch_size);
+        
+        for (int i = 0; i < sink_batch_size; ++i)
+        {
+            messages.push_back(makeMessage(i));
+        }
+        
+        sink.onOpen();
+        
+        const Clock::time_point start = Clock::now();
+        
+        for (std::int64_t i = 0; i < numMessages; i += sink_batch_size)
+        {
+            const auto count = static_cast<int>(std::min<std::int64_t>(sink_batch_size, numMessages - i));
+            
+            sink.prepare(count);
+            
+            for (int j = 0; j < count; ++j)
+            {
+                sink.print(messages[static_cast<std::size_t>(j)]);
+            }
+            
+            sink.flush();
+        }
+        
+        sink.onClose();
+        
+        const std::chrono::duration<double> elapsed = Clock::now() - start;
+        const auto                          bytes   = static_cast<double>(logFile.getSize());
+        
+        auto *result = new juce::DynamicObject();
+        result->setProperty("sink",              name);
+        result->setProperty("messages",          static_cast<juce::int64>(numMessages));
+        result->setProperty("messagesPerSecond", static_cast<double>(numMessages) / elapsed.count());
+        result->setProperty("bytesPerSecond",    bytes / elapsed.count());
+        
+        std::fprintf(stderr, "%-24s %14.0f msg/s %10.1f MiB/s\n", name,
+                     static_cast<double>(numMessages) / elapsed.count(), bytes / elapsed.count() / (1024.0 * 1024.0));
+        
+        return result;
+    }
+    
+    //==================================================================================================================
+    Settings parseSettings(int argc, char *argv[])
+    {
+        Settings settings;
+        
+        // Measuring sinks on a disk would measure the disk, so we prefer a tmpfs if there is one
+        const juce::File shm("/dev/shm");
+        settings.directory = (shm.isDirectory() ? shm
+                                                : juce::File::getSpecialLocation(juce::File::tempDirectory));
+        
+        for (int i = 1; i < argc; ++i)
+        {
+            const juce::String arg(argv[i]);
+            
+            if (i + 1 >= argc)
+            {
+                break;
+            }
+            
+            if (arg == "--messages")
+            {
+                settings.numMessages = std::max<std::int64_t>(1, std::stoll(argv[++i]));
+            }
+            else if (arg == "--dir")
+            {
+                settings.directory = juce::File::getCurrentWorkingDirectory().getChildFile(argv[++i]);
+            }
+            else if (arg == "--out")
+            {
+                settings.output = juce::File::getCurrentWorkingDirectory().getChildFile(argv[++i]);
+            }
+        }
+        
+        return settings;
+    }
+}
+
+
+
+//======================================================================================================================
+/**
+ *  Measures the loggers, formatters and file sinks and prints the results as JSON, so that they can be compared
+ *  between releases.<br>
+ *  Progress is printed to stderr, the results to stdout or the file given with --out.
+ *  
+ *  Usage: BenchmarkLOGGER [--messages <count>] [--dir <tmpfs directory>] [--out <json file>]
+ */
+int main(int argc, char *argv[])
+{
+    const Settings settings = parseSettings(argc, argv);
+    
+    // Loggers
+    juce::Array<juce::var> loggers;
+    runLogger<jaut::LoggerSimple>  (loggers, "LoggerSimple",   settings.numMessages, false);
+    runLogger<jaut::LoggerAsync>   (loggers, "LoggerAsync",    settings.numMessages, false);
+    runLogger<jaut::LoggerSimpleMT>(loggers, "LoggerSimpleMT", settings.numMessages, true);
+    runLogger<jaut::LoggerAsyncMT> (loggers, "LoggerAsyncMT",  settings.numMessages, true);
+    runLogger<jaut::LoggerSimpleTL>(loggers, "LoggerSimpleTL", settings.numMessages, true);
+    
+    // Formatters
+    juce::Array<juce::var> formatters;
+    formatters.add(measureFormatter("LogFormatPattern", jaut::LogFormatPattern(), settings.numMessages));
+    formatters.add(measureFormatter("LogFormatJson",    jaut::LogFormatJson(),    settings.numMessages));
+    formatters.add(measureFormatter("LogFormatXml",     jaut::LogFormatXml(),     settings.numMessages));
+    
+    // Sinks
+    const juce::File directory = settings.directory.getNonexistentChildFile("jaut-logger-benchmark", "");
+    
+    if (!directory.createDirectory())
+    {
+        std::cerr << "Could not create directory " << directory.getFullPathName() << std::endl;
+        return 1;
+    }
+    
+    juce::Array<juce::var> sinks;
+    
+    {
+        const juce::File  log_file = directory.getChildFile("file.log");
+        jaut::LogSinkFile sink(log_file);
+        sinks.add(measureSink("LogSinkFile", sink, log_file, settings.numMessages));
+    }
+    
+    {
+        const juce::File          log_file = directory.getChildFile("rotating.log");
+        jaut::LogSinkRotatingFile sink(log_file);
+        sinks.add(measureSink("LogSinkRotatingFile", sink, log_file, settings.numMessages));
+    }
+    
+    (void) directory.deleteRecursively();
+    
+    // Results
+    auto *results = new juce::DynamicObject();
+    results->setProperty("benchmark",  "Logger");
+    results->setProperty("messages",   static_cast<juce::int64>(settings.numMessages));
+    results->setProperty("directory",  settings.directory.getFullPathName());
+    results->setProperty("loggers",    loggers);
+    results->setProperty("formatters", formatters);
+    results->setProperty("sinks",      sinks);
+    
+    const juce::String json = juce::JSON::toString(juce::var(results));
+    
+    if (settings.output != juce::File())
+    {
+        if (!settings.output.replaceWithText(json))
+        {
+            std::cerr << "Could not write results to " << settings.output.getFullPathName() << std::endl;
+            return 1;
+        }
+    }
+    else
+    {
+        std::cout << json << std::endl;
+    }
+    
+    return 0;
+}
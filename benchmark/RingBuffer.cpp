@@ -0,0 +1,192 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2026 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   RingBuffer.cpp
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+
+#include <jaut_message/thread/buffer/jaut_AtomicRingBuffer.h>
+#include <jaut_message/thread/buffer/jaut_FastAtomicRingBuffer.h>
+#include <jaut_message/thread/buffer/jaut_MpscRingBuffer.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+
+
+//======================================================================================================================
+namespace
+{
+    /** The amount of elements each run transfers from the producer to the consumer. */
+    constexpr std::int64_t default_num_ops = 20'000'000;
+    
+    /** The amount of elements that are moved per call in batched runs. */
+    constexpr int batch_size = 64;
+    
+    //==================================================================================================================
+    /** A view over the part of a batch that should be pushed. */
+    struct BatchView
+    {
+        std::int64_t *first;
+        std::int64_t *last;
+        
+        std::int64_t* begin() const noexcept { return first; }
+        std::int64_t* end()   const noexcept { return last;  }
+    };
+    
+    //==================================================================================================================
+    /**
+     *  Measures how many elements per second can be transferred from one producer to one consumer thread.
+     *  
+     *  @param numOps  The amount of elements to transfer
+     *  @param batched Whether to use pushBatch/popBatch instead of push/pop
+     *  @return The amount of operations per second
+     */
+    template<class Buffer>
+    double measureThroughput(std::int64_t numOps, bool batched)
+    {
+        Buffer buffer;
+        
+        const auto start = std::chrono::steady_clock::now();
+        
+        std::thread producer([&buffer, numOps, batched]()
+        {
+            std::array<std::int64_t, batch_size> batch {};
+            
+            for (std::int64_t i = 0; i < numOps;)
+            {
+                if (batched)
+                {
+                    const auto count = static_cast<int>(std::min<std::int64_t>(batch_size, numOps - i));
+                    
+                    for (int j = 0; j < count; ++j)
+                    {
+                        batch[static_cast<std::size_t>(j)] = i + j;
+                    }
+                    
+                    const int pushed = buffer.pushBatch(BatchView { batch.data(), batch.data() + count });
+                    
+                    if (pushed == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                    
+                    i += pushed;
+                }
+                else if (buffer.push(i) > -1)
+                {
+                    ++i;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        
+        std::array<std::int64_t, batch_size> batch {};
+        std::int64_t checksum = 0;
+        
+        for (std::int64_t received = 0; received < numOps;)
+        {
+            if (batched)
+            {
+                const int count = buffer.popBatch(batch.begin(), batch_size);
+                
+                if (count == 0)
+                {
+                    std::this_thread::yield();
+                }
+                
+                for (int j = 0; j < count; ++j)
+                {
+                    checksum += batch[static_cast<std::size_t>(j)];
+                }
+                
+                received += count;
+            }
+            else if (!buffer.isEmpty())
+            {
+                checksum += buffer.pop();
+                ++received;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+        
+        producer.join();
+        
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        
+        // Make sure nothing got lost or the compiler optimised the transfer away
+        if (checksum != (numOps * (numOps - 1) / 2))
+        {
+            std::fprintf(stderr, "Checksum mismatch, the buffer lost or duplicated elements\n");
+            std::exit(1);
+        }
+        
+        return (static_cast<double>(numOps) / elapsed.count());
+    }
+    
+    template<class Buffer>
+    void runBenchmark(const char *name, std::int64_t numOps)
+    {
+        const double single  = measureThroughput<Buffer>(numOps, false);
+        const double batched = measureThroughput<Buffer>(numOps, true);
+        
+        std::printf("%-32s %16.0f %16.0f\n", name, single, batched);
+    }
+}
+
+
+
+//======================================================================================================================
+int main(int argc, char *argv[])
+{
+    const std::int64_t num_ops = (argc > 1 ? std::stoll(argv[1]) : default_num_ops);
+    
+    std::printf("Transferring %lld elements from one producer to one consumer thread\n\n",
+                static_cast<long long>(num_ops));
+    std::printf("%-32s %16s %16s\n", "Buffer", "ops/s", "ops/s (batched)");
+    
+    runBenchmark<jaut::AtomicRingBuffer<1024, std::int64_t>>    ("AtomicRingBuffer<1024>",     num_ops);
+    runBenchmark<jaut::FastAtomicRingBuffer<1024, std::int64_t>>("FastAtomicRingBuffer<1024>", num_ops);
+    runBenchmark<jaut::MpscRingBuffer<1024, std::int64_t>>      ("MpscRingBuffer<1024>",       num_ops);
+    
+    return 0;
+}
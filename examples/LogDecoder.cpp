@@ -0,0 +1,113 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   LogDecoder.cpp
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+
+#include <jaut_logger/format/jaut_LogFormatBinary.h>  // Include the binary formatter, which also has the decoder
+#include <jaut_logger/format/jaut_LogFormatJson.h>    // Include the json formatter for json output
+#include <jaut_logger/format/jaut_LogFormatPattern.h> // Include the pattern formatter for text output
+
+#include <iostream>
+
+
+
+//======================================================================================================================
+/**
+ *  This example shows how logs written with jaut::LogFormatBinary can be read again.
+ *  The decoder turns every record back into a log message, which we then simply feed into any other formatter.
+ *  
+ *  Usage: LogDecoder <binary log> [--json | --pattern <pattern>]
+ */
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: LogDecoder <binary log> [--json | --pattern <pattern>]" << std::endl;
+        return 1;
+    }
+    
+    // We pick the formatter the messages should be turned into, if none was given we use the default pattern
+    std::unique_ptr<jaut::ILogFormat> formatter;
+    
+    if (argc > 2 && juce::String(argv[2]) == "--json")
+    {
+        jaut::LogFormatJson::Options options;
+        options.jsonLines = true;
+        
+        formatter = std::make_unique<jaut::LogFormatJson>(options);
+    }
+    else if (argc > 3 && juce::String(argv[2]) == "--pattern")
+    {
+        formatter = std::make_unique<jaut::LogFormatPattern>(juce::String(argv[3]));
+    }
+    else
+    {
+        formatter = std::make_unique<jaut::LogFormatPattern>();
+    }
+    
+    const juce::File  log_file = juce::File::getCurrentWorkingDirectory().getChildFile(argv[1]);
+    juce::MemoryBlock data;
+    
+    if (!log_file.loadFileAsData(data))
+    {
+        std::cerr << "Could not read '" << log_file.getFullPathName() << "'" << std::endl;
+        return 1;
+    }
+    
+    // The decoder doesn't copy the data, it just reads it record by record
+    jaut::LogFormatBinary::Decoder         decoder(data.getData(), data.getSize());
+    jaut::LogFormatBinary::Decoder::Record record;
+    fmt::memory_buffer                     buffer;
+    
+    while (decoder.next(record))
+    {
+        // The original thread id can't be restored as std::thread::id,
+        // so we give unnamed threads their old id as name, that way we can still see where messages came from
+        if (record.message.threadName.isEmpty())
+        {
+            record.message.threadName = record.threadId;
+        }
+        
+        buffer.clear();
+        formatter->formatTo(buffer, record.message);
+        std::cout.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+    
+    if (decoder.hasFailed())
+    {
+        std::cerr << "The log is malformed after byte " << decoder.getPosition() << std::endl;
+        return 1;
+    }
+    
+    return 0;
+}
@@ -73,6 +73,12 @@
     // jaut::AtomicRingBuffer
     #define JAUT_ASSERT_ATOMIC_RING_BUFFER_INVALID_CAPACITY "BufferSize must be at least 1"
 
+    // jaut::MpscRingBuffer
+    #define JAUT_ASSERT_MPSC_RING_BUFFER_INVALID_CAPACITY "BufferSize of an MpscRingBuffer must be at least 1"
+
+    // jaut::FastAtomicRingBuffer
+    #define JAUT_ASSERT_FAST_RING_BUFFER_NOT_POWER_OF_TWO "BufferSize must be a power of two"
+
     // jaut::Logger
     #define JAUT_ASSERT_LOGGER_OBJECT_NO_TOSTRING \
         "The given object is neither convertible to string nor does it have a 'toString()' method"
@@ -82,6 +88,8 @@
         "Worker passed as template type is not an ILogWorker type"
     #define JAUT_ASSERT_LOGGER_WORKER_IS_ABSTRACT \
         "Worker passed as template type can not be an abstract class"
+    #define JAUT_ASSERT_LOGGER_RECORD_CANNOT_DEFER \
+        "The given arguments must be deferrable value types (see jaut::isLogDeferrable) that fit into a jaut::LogRecord"
 
     // jaut::Stringable
     #define JAUT_ASSERT_STRINGABLE_NOT_CONVERTIBLE_TO_JUCE_STRING \
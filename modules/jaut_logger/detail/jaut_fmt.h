@@ -79,6 +79,7 @@
 #include <jaut_logger/detail/fmt/args.h>
 #include <jaut_logger/detail/fmt/chrono.h>
 #include <jaut_logger/detail/fmt/color.h>
+#include <jaut_logger/detail/fmt/compile.h>
 #include <jaut_logger/detail/fmt/core.h>
 #include <jaut_logger/detail/fmt/format.h>
 #include <jaut_logger/detail/fmt/os.h>
@@ -95,17 +96,40 @@
 //======================================================================================================================
 
 
+//======================================================================================================================
+/**
+ *  Marks a format string for compile-time processing, for use with the formatting log methods of jaut::AbstractLogger.
+ *  <br><br>
+ *  The format string will be checked for errors when compiling and it will be parsed at compile time,
+ *  so that formatting doesn't need to parse the string again for every message.
+ *  
+ *  @code
+ *  logger.info(JAUT_FMT("x={}, y={}"), x, y);
+ *  @endcode
+ */
+#define JAUT_FMT(FORMAT) FMT_COMPILE(FORMAT)
+
 //======================================================================================================================
 namespace fmt
 {
     template<>
-    struct formatter<juce::String> : formatter<std::string>
+    struct formatter<juce::String> : formatter<string_view>
     {
         template<class FormatContext>
         auto format(const juce::String &string, FormatContext &ctx) const
             -> decltype(ctx.out())
         {
-            return formatter<std::string>::format(string.toStdString(), ctx);
+            if constexpr (std::is_same_v<juce::String::CharPointerType, juce::CharPointer_UTF8>)
+            {
+                // Read the string's UTF-8 representation in-place instead of copying it to an std::string first
+                const juce::CharPointer_UTF8 text = string.getCharPointer();
+                return formatter<string_view>::format(string_view(text.getAddress(), text.sizeInBytes() - 1), ctx);
+            }
+            else
+            {
+                const std::string text = string.toStdString();
+                return formatter<string_view>::format(string_view(text), ctx);
+            }
         }
     };
 }
@@ -0,0 +1,63 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogSymbolException.h
+    @date   17, October 2026
+
+    ===============================================================
+ */
+
+#pragma once
+
+#include <jaut_core/define/jaut_Define.h>
+
+#include <juce_core/juce_core.h>
+
+
+
+namespace jaut
+{
+    /** Thrown when a string can't be interned because the jaut::LogSymbolTable has run out of ids. */
+    class JAUT_API LogSymbolException : public std::exception
+    {
+    public:
+        explicit LogSymbolException(juce::String error)
+            : message(std::move(error))
+        {}
+    
+        //==============================================================================================================
+        JAUT_NODISCARD
+        const char* what() const noexcept override
+        {
+            return message.toRawUTF8();
+        }
+
+    private:
+        juce::String message;
+    };
+}
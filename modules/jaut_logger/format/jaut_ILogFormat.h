@@ -35,6 +35,7 @@
 #pragma once
 
 #include <jaut_logger/jaut_LogMessage.h>
+#include <jaut_logger/detail/jaut_fmt.h>
 
 #include <jaut_core/define/jaut_Define.h>
 
@@ -57,6 +58,29 @@ namespace jaut
      */
     struct JAUT_API ILogFormat
     {
+        //==============================================================================================================
+        /**
+         *  Describes a document, like a json array or an xml root element, that events can be appended to in-place,
+         *  without having to rewrite the entire output for every new event.
+         *  <br><br>
+         *  A sink will write the head followed by the closing sequence, and for every new event it will overwrite the
+         *  closing sequence with the separator (if there are already events), the event and the closing sequence again.
+         */
+        struct DocumentLayout
+        {
+            /** The start of the document, including all events that are already part of it. */
+            juce::String head;
+            
+            /** The sequence that separates two consecutive events. */
+            juce::String separator;
+            
+            /** The sequence that closes the document and that is overwritten by new events. */
+            juce::String closing;
+            
+            /** Whether the head already contains events. */
+            bool hasEvents { false };
+        };
+        
         //==============================================================================================================
         struct Util
         {
@@ -92,6 +116,36 @@ namespace jaut
         JAUT_NODISCARD
         virtual juce::String format(const LogMessage &logMessage) const = 0;
         
+        /**
+         *  Formats the incoming message and appends the UTF-8 encoded result to the given buffer.<br>
+         *  Sinks use this to reuse one buffer for all messages, formatters that can write directly into the buffer
+         *  should override this to avoid creating a juce::String for every message.
+         *  <br><br>
+         *  By default, this appends the result of format().
+         *  
+         *  @param buffer     The buffer to append the output to
+         *  @param logMessage The log event
+         */
+        virtual void formatTo(fmt::memory_buffer &buffer, const LogMessage &logMessage) const
+        {
+            const juce::String output = format(logMessage);
+            const char *const  data   = output.toRawUTF8();
+            buffer.append(data, data + output.getNumBytesAsUTF8());
+        }
+        
+        /**
+         *  Formats the incoming message as a single event of the document that was created with openDocument()
+         *  and appends the UTF-8 encoded result to the given buffer.<br>
+         *  By default, this appends the result of formatTo().
+         *  
+         *  @param buffer     The buffer to append the output to
+         *  @param logMessage The log event
+         */
+        virtual void formatEventTo(fmt::memory_buffer &buffer, const LogMessage &logMessage) const
+        {
+            formatTo(buffer, logMessage);
+        }
+        
         /**
          *  Formats the incoming message together with all the last log events and formats the stream so that it
          *  can be replaced together with the latest log event.
@@ -107,6 +161,42 @@ namespace jaut
             return {};
         }
         
+        /**
+         *  Formats the incoming message together with all the last log events and appends the UTF-8 encoded output,
+         *  that should replace the current output, to the given buffer.<br>
+         *  Sinks use this so that the replacing output only needs to be rendered once, as they can take its size
+         *  right from the buffer.
+         *  <br><br>
+         *  By default, this appends the result of formatReplace().
+         *  
+         *  @param buffer     The buffer to append the output to
+         *  @param logMessage The log event
+         *  @param content    The entire content of the current output, this means all previous log events
+         */
+        virtual void formatReplaceTo(fmt::memory_buffer &buffer,
+                                     const LogMessage   &logMessage,
+                                     const juce::String &content)
+        {
+            const juce::String output = formatReplace(logMessage, content);
+            const char *const  data   = output.toRawUTF8();
+            buffer.append(data, data + output.getNumBytesAsUTF8());
+        }
+        
+        /**
+         *  Creates the document that events should be appended to in-place, as an alternative to formatReplace().
+         *  <br><br>
+         *  This gets the current content of the output, so that previous events can be carried over into the new
+         *  document.
+         *  
+         *  @param content The entire content of the current output
+         *  @return The document layout or std::nullopt if this formatter doesn't support in-place documents
+         */
+        JAUT_NODISCARD
+        virtual std::optional<DocumentLayout> openDocument(JAUT_MUNUSED const juce::String &content) const
+        {
+            return std::nullopt;
+        }
+        
         //==============================================================================================================
         /**
          *  Gets the header that will be printed on construction of the sink.<br>
@@ -0,0 +1,684 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogFormatBinary.cpp
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+
+#include <jaut_logger/format/jaut_LogFormatBinary.h>
+
+#include <jaut_core/util/jaut_VarUtil.h>
+
+#include <cstring>
+#include <limits>
+
+
+
+//**********************************************************************************************************************
+// region Namespace
+//======================================================================================================================
+namespace
+{
+    //==================================================================================================================
+    using RecordType = jaut::LogFormatBinary::RecordType;
+    using ValueType  = jaut::LogFormatBinary::ValueType;
+    
+    //==================================================================================================================
+    JAUT_NODISCARD
+    constexpr std::uint64_t encodeZigZag(juce::int64 value) noexcept
+    {
+        return ((static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+    }
+    
+    JAUT_NODISCARD
+    constexpr juce::int64 decodeZigZag(std::uint64_t value) noexcept
+    {
+        return static_cast<juce::int64>((value >> 1) ^ (~(value & 1) + 1));
+    }
+    
+    //==================================================================================================================
+    void writeByte(fmt::memory_buffer &buffer, std::uint8_t value)
+    {
+        buffer.push_back(static_cast<char>(value));
+    }
+    
+    void writeVarint(fmt::memory_buffer &buffer, std::uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            writeByte(buffer, static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        
+        writeByte(buffer, static_cast<std::uint8_t>(value));
+    }
+    
+    void writeBytes(fmt::memory_buffer &buffer, const void *data, std::size_t size)
+    {
+        writeVarint(buffer, size);
+        
+        const char *const bytes = static_cast<const char*>(data);
+        buffer.append(bytes, bytes + size);
+    }
+    
+    void writeString(fmt::memory_buffer &buffer, const juce::String &text)
+    {
+        writeBytes(buffer, text.toRawUTF8(), text.getNumBytesAsUTF8());
+    }
+    
+    void writeDouble(fmt::memory_buffer &buffer, double value)
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        
+        for (int i = 0; i < 8; ++i)
+        {
+            writeByte(buffer, static_cast<std::uint8_t>(bits >> (i * 8)));
+        }
+    }
+    
+    void writeValue(fmt::memory_buffer &buffer, const juce::var &value)
+    {
+        using VarTypeId = jaut::VarUtil::VarTypeId;
+        
+        switch (jaut::VarUtil::getVarType(value))
+        {
+            case VarTypeId::Bool:
+                writeByte(buffer, static_cast<std::uint8_t>(static_cast<bool>(value) ? ValueType::True
+                                                                                     : ValueType::False));
+                break;
+            
+            case VarTypeId::Int:
+            case VarTypeId::Int64:
+                writeByte(buffer, static_cast<std::uint8_t>(ValueType::Int));
+                writeVarint(buffer, ::encodeZigZag(static_cast<juce::int64>(value)));
+                break;
+            
+            case VarTypeId::Double:
+                writeByte(buffer, static_cast<std::uint8_t>(ValueType::Double));
+                writeDouble(buffer, static_cast<double>(value));
+                break;
+            
+            case VarTypeId::String:
+                writeByte(buffer, static_cast<std::uint8_t>(ValueType::String));
+                writeString(buffer, value.toString());
+                break;
+            
+            case VarTypeId::BinaryData:
+            {
+                const juce::MemoryBlock &block = *value.getBinaryData();
+                
+                writeByte(buffer, static_cast<std::uint8_t>(ValueType::Binary));
+                writeBytes(buffer, block.getData(), block.getSize());
+                break;
+            }
+            
+            case VarTypeId::Array:
+            case VarTypeId::DynamicObject:
+                // Objects and arrays are rare enough in fields that we can leave them to juce
+                writeByte(buffer, static_cast<std::uint8_t>(ValueType::Json));
+                writeString(buffer, juce::JSON::toString(value, true));
+                break;
+            
+            case VarTypeId::Undefined:
+                writeByte(buffer, static_cast<std::uint8_t>(ValueType::Undefined));
+                break;
+            
+            default:
+                // Methods and other objects can't be restored anyway
+                writeByte(buffer, static_cast<std::uint8_t>(ValueType::Void));
+        }
+    }
+    
+    //==================================================================================================================
+    class ByteReader
+    {
+    public:
+        ByteReader(const std::uint8_t *parData, std::size_t parSize) noexcept
+            : data(parData), size(parSize)
+        {}
+        
+        //==============================================================================================================
+        bool readByte(std::uint8_t &value) noexcept
+        {
+            if (position >= size)
+            {
+                return false;
+            }
+            
+            value = data[position++];
+            return true;
+        }
+        
+        bool readVarint(std::uint64_t &value) noexcept
+        {
+            value = 0;
+            
+            for (int shift = 0; shift < 64; shift += 7)
+            {
+                std::uint8_t byte;
+                
+                if (!readByte(byte))
+                {
+                    return false;
+                }
+                
+                value |= (static_cast<std::uint64_t>(byte & 0x7f) << shift);
+                
+                if ((byte & 0x80) == 0)
+                {
+                    return true;
+                }
+            }
+            
+            return false;
+        }
+        
+        bool readBytes(const std::uint8_t *&bytes, std::size_t &length) noexcept
+        {
+            std::uint64_t value;
+            
+            if (!readVarint(value) || value > (size - position))
+            {
+                return false;
+            }
+            
+            bytes     = (data + position);
+            length    = static_cast<std::size_t>(value);
+            position += length;
+            
+            return true;
+        }
+        
+        bool readString(juce::String &text)
+        {
+            const std::uint8_t *bytes;
+            std::size_t        length;
+            
+            if (!readBytes(bytes, length))
+            {
+                return false;
+            }
+            
+            text = juce::String::fromUTF8(reinterpret_cast<const char*>(bytes), static_cast<int>(length));
+            return true;
+        }
+        
+        bool readDouble(double &value) noexcept
+        {
+            std::uint64_t bits = 0;
+            
+            for (int i = 0; i < 8; ++i)
+            {
+                std::uint8_t byte;
+                
+                if (!readByte(byte))
+                {
+                    return false;
+                }
+                
+                bits |= (static_cast<std::uint64_t>(byte) << (i * 8));
+            }
+            
+            std::memcpy(&value, &bits, sizeof(value));
+            return true;
+        }
+        
+        bool readValue(juce::var &value)
+        {
+            std::uint8_t type;
+            
+            if (!readByte(type))
+            {
+                return false;
+            }
+            
+            switch (static_cast<ValueType>(type))
+            {
+                case ValueType::Void:      value = juce::var();            return true;
+                case ValueType::Undefined: value = juce::var::undefined(); return true;
+                case ValueType::False:     value = false;                  return true;
+                case ValueType::True:      value = true;                   return true;
+                
+                case ValueType::Int:
+                {
+                    std::uint64_t number;
+                    
+                    if (!readVarint(number))
+                    {
+                        return false;
+                    }
+                    
+                    const juce::int64 result = ::decodeZigZag(number);
+                    
+                    if (result >= std::numeric_limits<int>::min() && result <= std::numeric_limits<int>::max())
+                    {
+                        value = static_cast<int>(result);
+                    }
+                    else
+                    {
+                        value = result;
+                    }
+                    
+                    return true;
+                }
+                
+                case ValueType::Double:
+                {
+                    double number;
+                    
+                    if (!readDouble(number))
+                    {
+                        return false;
+                    }
+                    
+                    value = number;
+                    return true;
+                }
+                
+                case ValueType::String:
+                {
+                    juce::String text;
+                    
+                    if (!readString(text))
+                    {
+                        return false;
+                    }
+                    
+                    value = std::move(text);
+                    return true;
+                }
+                
+                case ValueType::Binary:
+                {
+                    const std::uint8_t *bytes;
+                    std::size_t        length;
+                    
+                    if (!readBytes(bytes, length))
+                    {
+                        return false;
+                    }
+                    
+                    value = juce::MemoryBlock(bytes, length);
+                    return true;
+                }
+                
+                case ValueType::Json:
+                {
+                    juce::String json;
+                    
+                    if (!readString(json))
+                    {
+                        return false;
+                    }
+                    
+                    value = juce::JSON::parse(json);
+                    return true;
+                }
+            }
+            
+            return false;
+        }
+        
+        //==============================================================================================================
+        JAUT_NODISCARD
+        const std::uint8_t* getRemaining() const noexcept { return (data + position); }
+        
+        JAUT_NODISCARD
+        std::size_t getNumRemaining() const noexcept { return (size - position); }
+        
+    private:
+        const std::uint8_t *data;
+        std::size_t        size;
+        std::size_t        position { 0 };
+    };
+}
+//======================================================================================================================
+// endregion Namespace
+//**********************************************************************************************************************
+// region LogFormatBinary::Decoder
+//======================================================================================================================
+namespace jaut
+{
+    //==================================================================================================================
+    LogFormatBinary::Decoder::Decoder(const void *parData, std::size_t parSize) noexcept
+        : data(static_cast<const std::uint8_t*>(parData)),
+          size(parSize)
+    {}
+    
+    //==================================================================================================================
+    bool LogFormatBinary::Decoder::next(Record &parRecord)
+    {
+        while (!failed && position < size)
+        {
+            // Every log starts with the header, which is where the formatter started over
+            if (data[position] == static_cast<std::uint8_t>(header.front()))
+            {
+                const void *const line_end = std::memchr(data + position, '\n', size - position);
+                position = (line_end ? static_cast<std::size_t>(static_cast<const std::uint8_t*>(line_end) - data) + 1
+                                     : size);
+                reset();
+                continue;
+            }
+            
+            ::ByteReader reader(data + position, size - position);
+            
+            std::uint8_t        type;
+            const std::uint8_t *payload;
+            std::size_t         length;
+            
+            if (!reader.readByte(type) || !reader.readBytes(payload, length))
+            {
+                failed = true;
+                break;
+            }
+            
+            position = static_cast<std::size_t>(reader.getRemaining() - data);
+            
+            switch (static_cast<RecordType>(type))
+            {
+                case RecordType::Symbol:
+                {
+                    ::ByteReader  symbol_reader(payload, length);
+                    std::uint64_t id;
+                    
+                    if (!symbol_reader.readVarint(id))
+                    {
+                        failed = true;
+                        break;
+                    }
+                    
+                    symbols[id] = LogSymbol(juce::String::fromUTF8(
+                        reinterpret_cast<const char*>(symbol_reader.getRemaining()),
+                        static_cast<int>(symbol_reader.getNumRemaining())
+                    ));
+                    break;
+                }
+                
+                case RecordType::Sync:
+                {
+                    ::ByteReader  sync_reader(payload, length);
+                    std::uint64_t timestamp;
+                    
+                    if (!sync_reader.readVarint(timestamp))
+                    {
+                        failed = true;
+                        break;
+                    }
+                    
+                    lastTimestamp = ::decodeZigZag(timestamp);
+                    break;
+                }
+                
+                case RecordType::Event:
+                    if (readEvent(payload, length, parRecord))
+                    {
+                        return true;
+                    }
+                    
+                    failed = true;
+                    break;
+                
+                // Newer versions might know more records, which we can safely skip
+                default: break;
+            }
+        }
+        
+        return false;
+    }
+    
+    //==================================================================================================================
+    bool LogFormatBinary::Decoder::hasFailed() const noexcept
+    {
+        return failed;
+    }
+    
+    std::size_t LogFormatBinary::Decoder::getPosition() const noexcept
+    {
+        return position;
+    }
+    
+    //==================================================================================================================
+    bool LogFormatBinary::Decoder::readEvent(const std::uint8_t *parPayload, std::size_t parLength, Record &parRecord)
+    {
+        ::ByteReader reader(parPayload, parLength);
+        LogMessage   &message = parRecord.message;
+        
+        std::uint64_t delta, name_id, thread_name_id, thread_id, num_fields;
+        std::uint8_t  level, flags;
+        
+        if (   !reader.readVarint(delta)
+            || !reader.readByte(level)
+            || !reader.readVarint(name_id)
+            || !reader.readVarint(thread_name_id)
+            || !reader.readVarint(thread_id)
+            || !reader.readString(message.message)
+            || !reader.readByte(flags)
+            || level >= LogLevel::names.size())
+        {
+            return false;
+        }
+        
+        lastTimestamp += ::decodeZigZag(delta);
+        
+        message.timestamp  = juce::Time(lastTimestamp);
+        message.level      = static_cast<LogLevel::Value>(level);
+        message.name       = getSymbol(name_id);
+        message.threadName = getSymbol(thread_name_id);
+        message.threadId   = std::thread::id();
+        parRecord.threadId = getSymbol(thread_id).toString();
+        
+        message.exception.reset();
+        
+        if ((flags & 1) != 0)
+        {
+            LogMessage::ExceptionSpec exception;
+            
+            if (!reader.readString(exception.name) || !reader.readString(exception.message))
+            {
+                return false;
+            }
+            
+            message.exception = std::move(exception);
+        }
+        
+        message.fields.clear();
+        
+        if (!reader.readVarint(num_fields))
+        {
+            return false;
+        }
+        
+        for (std::uint64_t i = 0; i < num_fields; ++i)
+        {
+            std::uint64_t field_name;
+            juce::var     value;
+            
+            if (!reader.readVarint(field_name) || !reader.readValue(value))
+            {
+                return false;
+            }
+            
+            message.fields.push_back({ getSymbol(field_name), std::move(value) });
+        }
+        
+        return true;
+    }
+    
+    void LogFormatBinary::Decoder::reset()
+    {
+        symbols.clear();
+        lastTimestamp = 0;
+    }
+    
+    //==================================================================================================================
+    LogSymbol LogFormatBinary::Decoder::getSymbol(std::uint64_t parId) const
+    {
+        if (parId == 0)
+        {
+            return {};
+        }
+        
+        if (const auto it = symbols.find(parId); it != symbols.end())
+        {
+            return it->second;
+        }
+        
+        // The log is incomplete, but we can still tell apart which messages belong together
+        return LogSymbol("#" + juce::String(static_cast<juce::int64>(parId)));
+    }
+}
+//======================================================================================================================
+// endregion LogFormatBinary::Decoder
+//**********************************************************************************************************************
+// region LogFormatBinary
+//======================================================================================================================
+namespace jaut
+{
+    //==================================================================================================================
+    juce::String LogFormatBinary::format(const LogMessage &parLogMessage) const
+    {
+        fmt::memory_buffer buffer;
+        formatTo(buffer, parLogMessage);
+        
+        return juce::Base64::toBase64(buffer.data(), buffer.size());
+    }
+    
+    void LogFormatBinary::formatTo(fmt::memory_buffer &parBuffer, const LogMessage &parLogMessage) const
+    {
+        const juce::SpinLock::ScopedLockType lock(stateLock);
+        const juce::int64                    timestamp = parLogMessage.timestamp.toMilliseconds();
+        
+        if (!std::exchange(synced, true))
+        {
+            payload.clear();
+            ::writeVarint(payload, ::encodeZigZag(timestamp));
+            writeRecord(parBuffer, RecordType::Sync);
+            
+            lastTimestamp = timestamp;
+        }
+        
+        auto thread_it = threadIds.find(parLogMessage.threadId);
+        
+        if (thread_it == threadIds.end())
+        {
+            const std::string thread_id = fmt::format("{}", parLogMessage.threadId);
+            thread_it = threadIds.emplace(parLogMessage.threadId, LogSymbol(juce::String(thread_id))).first;
+        }
+        
+        // Symbols must be known before the event that uses them
+        writeSymbol(parBuffer, parLogMessage.name);
+        writeSymbol(parBuffer, parLogMessage.threadName);
+        writeSymbol(parBuffer, thread_it->second);
+        
+        for (const LogMessage::Field &field : parLogMessage.fields)
+        {
+            writeSymbol(parBuffer, field.name);
+        }
+        
+        payload.clear();
+        ::writeVarint(payload, ::encodeZigZag(timestamp - lastTimestamp));
+        ::writeByte  (payload, static_cast<std::uint8_t>(parLogMessage.level));
+        ::writeVarint(payload, parLogMessage.name.getId());
+        ::writeVarint(payload, parLogMessage.threadName.getId());
+        ::writeVarint(payload, thread_it->second.getId());
+        ::writeString(payload, parLogMessage.message);
+        ::writeByte  (payload, static_cast<std::uint8_t>(parLogMessage.exception.has_value() ? 1 : 0));
+        
+        if (parLogMessage.exception.has_value())
+        {
+            ::writeString(payload, parLogMessage.exception->name);
+            ::writeString(payload, parLogMessage.exception->message);
+        }
+        
+        ::writeVarint(payload, parLogMessage.fields.size());
+        
+        for (const LogMessage::Field &field : parLogMessage.fields)
+        {
+            ::writeVarint(payload, field.name.getId());
+            ::writeValue (payload, field.value);
+        }
+        
+        writeRecord(parBuffer, RecordType::Event);
+        lastTimestamp = timestamp;
+    }
+    
+    //==================================================================================================================
+    juce::String LogFormatBinary::getHeader() const
+    {
+        const juce::SpinLock::ScopedLockType lock(stateLock);
+        
+        writtenSymbols.clear();
+        synced = false;
+        
+        return juce::String(header.data(), header.size());
+    }
+    
+    //==================================================================================================================
+    bool LogFormatBinary::supportsReplacingFormatter() const noexcept
+    {
+        return false;
+    }
+    
+    //==================================================================================================================
+    void LogFormatBinary::writeSymbol(fmt::memory_buffer &parBuffer, LogSymbol parSymbol) const
+    {
+        const std::uint32_t id = parSymbol.getId();
+        
+        if (id == 0 || (id < writtenSymbols.size() && writtenSymbols[id]))
+        {
+            return;
+        }
+        
+        if (id >= writtenSymbols.size())
+        {
+            writtenSymbols.resize(static_cast<std::size_t>(id) + 1);
+        }
+        
+        writtenSymbols[id] = true;
+        
+        const juce::String &text = parSymbol.toString();
+        
+        payload.clear();
+        ::writeVarint(payload, id);
+        payload.append(text.toRawUTF8(), text.toRawUTF8() + text.getNumBytesAsUTF8());
+        writeRecord(parBuffer, RecordType::Symbol);
+    }
+    
+    void LogFormatBinary::writeRecord(fmt::memory_buffer &parBuffer, RecordType parType) const
+    {
+        ::writeByte (parBuffer, static_cast<std::uint8_t>(parType));
+        ::writeBytes(parBuffer, payload.data(), payload.size());
+    }
+}
+//======================================================================================================================
+// endregion LogFormatBinary
+//**********************************************************************************************************************
@@ -0,0 +1,218 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogFormatBinary.h
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+
+#pragma once
+
+#include <jaut_logger/jaut_LogMessage.h>
+#include <jaut_logger/format/jaut_ILogFormat.h>
+
+#include <jaut_core/define/jaut_Define.h>
+
+#include <juce_core/juce_core.h>
+
+#include <unordered_map>
+
+
+
+namespace jaut
+{
+    //==================================================================================================================
+    /**
+     *  Provides a formatter that writes log events as compact binary records, for high-volume logs that are read by
+     *  tools rather than by people.<br>
+     *  Use LogFormatBinary::Decoder to turn them back into jaut::LogMessage objects, which can then be fed into any
+     *  other formatter, like the LogDecoder example does.
+     *  <br><br>
+     *  Every record starts with its type and the varint encoded length of its payload, so that decoders can skip
+     *  records they don't know.<br>
+     *  Logger names, thread names, thread ids and field names are written as ids of the jaut::LogSymbolTable and
+     *  their text is only written once, the first time they appear in the log.
+     *  Timestamps are written as the distance to the timestamp of the previous event.
+     *  Field values are written in their binary representation, depending on their juce::var type.
+     *  <br><br>
+     *  The header of this formatter tells the formatter to start over, so that every log that starts with the header
+     *  can be decoded on its own.<br>
+     *  Hence, this should only be used with sinks that print the header whenever they open a new log, sinks that
+     *  don't append to the log can't be used.
+     *  <br><br>
+     *  Since the output isn't text, this can only be used with sinks that write through ILogFormat::formatTo(),
+     *  format() itself returns the record encoded in base64.
+     */
+    class JAUT_API LogFormatBinary : public ILogFormat
+    {
+    public:
+        /** The line every binary log starts with. */
+        static constexpr std::string_view header = "#jaut-log-binary 1";
+        
+        //==============================================================================================================
+        /** The types of records a binary log consists of. */
+        enum class RecordType : std::uint8_t
+        {
+            /** Defines the text of a symbol id. */
+            Symbol = 0x01,
+            
+            /** Sets the timestamp the next event's timestamp is relative to. */
+            Sync = 0x02,
+            
+            /** A log event. */
+            Event = 0x03
+        };
+        
+        /** The types of field values. */
+        enum class ValueType : std::uint8_t
+        {
+            Void,
+            Undefined,
+            False,
+            True,
+            Int,
+            Double,
+            String,
+            Binary,
+            
+            /** Arrays and objects, which are written as json. */
+            Json
+        };
+        
+        //==============================================================================================================
+        /** Reads the records written by a LogFormatBinary formatter. */
+        class JAUT_API Decoder
+        {
+        public:
+            /** A decoded log event. */
+            struct Record
+            {
+                /** The log event, without the thread id. */
+                LogMessage message;
+                
+                /**
+                 *  The id of the thread that issued the event.<br>
+                 *  Since a std::thread::id can't be recreated, this is the id as it would have been formatted.
+                 */
+                juce::String threadId;
+            };
+            
+            //==========================================================================================================
+            /**
+             *  Creates a new decoder for the given data.<br>
+             *  The data is not copied, so it must outlive this decoder.
+             *  
+             *  @param data The binary log
+             *  @param size The size of the binary log in bytes
+             */
+            Decoder(const void *data, std::size_t size) noexcept;
+            
+            //==========================================================================================================
+            /**
+             *  Reads the next log event.<br>
+             *  Headers and records of other types are consumed along the way.
+             *  
+             *  @param record The record to write the event to
+             *  @return True if an event was read, false if there are no more events or the data is malformed
+             */
+            bool next(Record &record);
+            
+            //==========================================================================================================
+            /**
+             *  Whether the data was malformed.
+             *  @return True if decoding stopped because of malformed data, false if not
+             */
+            JAUT_NODISCARD
+            bool hasFailed() const noexcept;
+            
+            /**
+             *  Gets the number of bytes that were consumed so far.
+             *  @return The offset of the next record
+             */
+            JAUT_NODISCARD
+            std::size_t getPosition() const noexcept;
+            
+        private:
+            std::unordered_map<std::uint64_t, LogSymbol> symbols;
+            
+            const std::uint8_t *data;
+            std::size_t        size;
+            std::size_t        position { 0 };
+            juce::int64        lastTimestamp { 0 };
+            bool               failed { false };
+            
+            //==========================================================================================================
+            bool readEvent(const std::uint8_t *payload, std::size_t length, Record &record);
+            void reset();
+            
+            //==========================================================================================================
+            JAUT_NODISCARD
+            LogSymbol getSymbol(std::uint64_t id) const;
+        };
+        
+        //==============================================================================================================
+        LogFormatBinary() = default;
+        
+        //==============================================================================================================
+        JAUT_NODISCARD
+        juce::String format(const LogMessage &logMessage) const override;
+        
+        void formatTo(fmt::memory_buffer &buffer, const LogMessage &logMessage) const override;
+        
+        //==============================================================================================================
+        /**
+         *  Gets the header, which also resets the formatter, so that all symbols and the timestamp base will be
+         *  written again.
+         *  
+         *  @return The header string
+         */
+        JAUT_NODISCARD
+        juce::String getHeader() const override;
+        
+        //==============================================================================================================
+        JAUT_NODISCARD
+        bool supportsReplacingFormatter() const noexcept override;
+        
+    private:
+        mutable std::vector<bool>                              writtenSymbols;
+        mutable std::unordered_map<std::thread::id, LogSymbol> threadIds;
+        mutable fmt::memory_buffer                             payload;
+        mutable juce::int64                                    lastTimestamp { 0 };
+        mutable bool                                           synced { false };
+        mutable juce::SpinLock                                 stateLock;
+        
+        //==============================================================================================================
+        void writeSymbol(fmt::memory_buffer &buffer, LogSymbol symbol) const;
+        void writeRecord(fmt::memory_buffer &buffer, RecordType type) const;
+        
+        //==============================================================================================================
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LogFormatBinary)
+    };
+}
@@ -42,12 +42,231 @@
 //======================================================================================================================
 namespace
 {
-    juce::var createJsonObject(const jaut::LogMessage &logMessage)
+    class JsonWriter
+    {
+    public:
+        JsonWriter(fmt::memory_buffer &parBuffer, bool parPrettyPrint) noexcept
+            : buffer(parBuffer), prettyPrint(parPrettyPrint)
+        {}
+        
+        //==============================================================================================================
+        void beginObject() { beginValue(); append('{'); push(); }
+        void endObject()   { pop('}'); }
+        void beginArray()  { beginValue(); append('['); push(); }
+        void endArray()    { pop(']'); }
+        
+        //==============================================================================================================
+        void key(std::string_view name)
+        {
+            nextElement();
+            writeString(name);
+            append(prettyPrint ? ": " : ":");
+            expectsValue = true;
+        }
+        
+        //==============================================================================================================
+        void value(std::nullptr_t)              { beginValue(); append("null"); }
+        void value(bool boolean)                { beginValue(); append(boolean ? "true" : "false"); }
+        void value(juce::int64 number)          { beginValue(); fmt::format_to(std::back_inserter(buffer), "{}", number); }
+        void value(std::string_view text)       { beginValue(); writeString(text); }
+        void value(const juce::String &text)    { value(std::string_view(text.toRawUTF8(), text.getNumBytesAsUTF8())); }
+        
+        void value(double number)
+        {
+            if (!std::isfinite(number))
+            {
+                value(nullptr);
+                return;
+            }
+            
+            beginValue();
+            fmt::format_to(std::back_inserter(buffer), "{}", number);
+        }
+        
+        void value(const juce::var &var)
+        {
+            if      (var.isVoid() || var.isUndefined()) value(nullptr);
+            else if (var.isBool())                      value(static_cast<bool>(var));
+            else if (var.isInt() || var.isInt64())      value(static_cast<juce::int64>(var));
+            else if (var.isDouble())                    value(static_cast<double>(var));
+            else if (var.isString())                    value(var.toString());
+            else
+            {
+                // Objects and arrays are rare enough in fields that we can leave them to juce
+                const juce::String json = juce::JSON::toString(var, true);
+                
+                beginValue();
+                append(std::string_view(json.toRawUTF8(), json.getNumBytesAsUTF8()));
+            }
+        }
+        
+    private:
+        static constexpr int maxDepth = 8;
+        
+        //==============================================================================================================
+        fmt::memory_buffer &buffer;
+        std::array<bool, maxDepth> first {};
+        int  depth        { 0 };
+        bool prettyPrint;
+        bool expectsValue { false };
+        
+        //==============================================================================================================
+        void append(char c)                { buffer.push_back(c); }
+        void append(std::string_view text) { buffer.append(text.data(), text.data() + text.size()); }
+        
+        void newLine()
+        {
+            append(juce::newLine.getDefault());
+            
+            for (int i = 0; i < depth; ++i)
+            {
+                append("  ");
+            }
+        }
+        
+        //==============================================================================================================
+        void beginValue()
+        {
+            if (std::exchange(expectsValue, false))
+            {
+                return;
+            }
+            
+            nextElement();
+        }
+        
+        void nextElement()
+        {
+            if (depth == 0)
+            {
+                return;
+            }
+            
+            if (!std::exchange(first[static_cast<std::size_t>(depth)], false))
+            {
+                append(',');
+            }
+            
+            if (prettyPrint)
+            {
+                newLine();
+            }
+        }
+        
+        void push()
+        {
+            jassert(depth + 1 < maxDepth);
+            first[static_cast<std::size_t>(++depth)] = true;
+        }
+        
+        void pop(char closing)
+        {
+            const bool was_empty = first[static_cast<std::size_t>(depth)];
+            --depth;
+            
+            if (prettyPrint && !was_empty)
+            {
+                newLine();
+            }
+            
+            append(closing);
+        }
+        
+        void writeString(std::string_view text)
+        {
+            static constexpr std::string_view hex_digits = "0123456789abcdef";
+            
+            append('"');
+            
+            for (const char c : text)
+            {
+                switch (c)
+                {
+                    case '"':  append("\\\""); break;
+                    case '\\': append("\\\\"); break;
+                    case '\n': append("\\n");  break;
+                    case '\r': append("\\r");  break;
+                    case '\t': append("\\t");  break;
+                    case '\b': append("\\b");  break;
+                    case '\f': append("\\f");  break;
+                    
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20)
+                        {
+                            append("\\u00");
+                            append(hex_digits[static_cast<unsigned char>(c) >> 4]);
+                            append(hex_digits[static_cast<unsigned char>(c) & 0xf]);
+                        }
+                        else
+                        {
+                            append(c);
+                        }
+                }
+            }
+            
+            append('"');
+        }
+    };
+    
+    //==================================================================================================================
+    void writeJsonObject(JsonWriter &writer, const jaut::LogMessage &logMessage, bool omitEmpty)
+    {
+        fmt::basic_memory_buffer<char, 32> thread_id;
+        fmt::format_to(std::back_inserter(thread_id), "{}", logMessage.threadId);
+        
+        writer.beginObject();
+        writer.key("name");        writer.value(logMessage.name.toString());
+        writer.key("message");     writer.value(logMessage.message);
+        writer.key("thread_name"); writer.value(logMessage.threadName.toString());
+        writer.key("thread_id");   writer.value(std::string_view(thread_id.data(), thread_id.size()));
+        writer.key("timestamp");   writer.value(logMessage.timestamp.toMilliseconds());
+        
+        writer.key("level");
+        writer.beginObject();
+        writer.key("id");   writer.value(static_cast<juce::int64>(logMessage.level));
+        writer.key("name"); writer.value(jaut::LogLevel::names[static_cast<std::size_t>(logMessage.level)]);
+        writer.endObject();
+        
+        if (logMessage.exception.has_value())
+        {
+            writer.key("exception");
+            writer.beginObject();
+            writer.key("name");    writer.value(logMessage.exception->name);
+            writer.key("message"); writer.value(logMessage.exception->message);
+            writer.endObject();
+        }
+        else if (!omitEmpty)
+        {
+            writer.key("exception");
+            writer.value(nullptr);
+        }
+        
+        if (!omitEmpty || !logMessage.fields.empty())
+        {
+            writer.key("fields");
+            writer.beginArray();
+            
+            for (const jaut::LogMessage::Field &field : logMessage.fields)
+            {
+                writer.beginObject();
+                writer.key("name");  writer.value(field.name.toString());
+                writer.key("value"); writer.value(field.value);
+                writer.endObject();
+            }
+            
+            writer.endArray();
+        }
+        
+        writer.endObject();
+    }
+    
+    //==================================================================================================================
+    juce::var createJsonObject(const jaut::LogMessage &logMessage, bool omitEmpty)
     {
         auto root_obj = std::make_unique<juce::DynamicObject>();
-        root_obj->setProperty("name",        logMessage.name);
+        root_obj->setProperty("name",        logMessage.name.toString());
         root_obj->setProperty("message",     logMessage.message);
-        root_obj->setProperty("thread_name", logMessage.threadName);
+        root_obj->setProperty("thread_name", logMessage.threadName.toString());
         root_obj->setProperty("thread_id",   jaut::toString(logMessage.threadId));
         root_obj->setProperty("timestamp",   logMessage.timestamp.toMilliseconds());
         
@@ -63,11 +282,12 @@ namespace
             ex_obj->setProperty("message", logMessage.exception.value().message);
             root_obj->setProperty("exception", ex_obj.release());
         }
-        else
+        else if (!omitEmpty)
         {
             root_obj->setProperty("exception", {});
         }
     
+        if (!omitEmpty || !logMessage.fields.empty())
         {
             juce::Array<juce::var> fields;
             fields.ensureStorageAllocated(static_cast<int>(logMessage.fields.size()));
@@ -75,7 +295,7 @@ namespace
             for (const jaut::LogMessage::Field &field: logMessage.fields)
             {
                 auto field_obj = std::make_unique<juce::DynamicObject>();
-                field_obj->setProperty("name", field.name);
+                field_obj->setProperty("name", field.name.toString());
                 field_obj->setProperty("value", field.value);
                 fields.add(field_obj.release());
             }
@@ -138,15 +358,44 @@ namespace jaut
     //==================================================================================================================
     juce::String LogFormatJson::format(const LogMessage &parLogMessage) const
     {
-        const juce::var output = ::createJsonObject(parLogMessage);
-        return juce::JSON::toString(output, !options.prettyPrint) + ','
-                                                + (options.prettyPrint ? juce::newLine.getDefault() : "");
+        fmt::memory_buffer buffer;
+        formatTo(buffer, parLogMessage);
+        
+        return juce::String::fromUTF8(buffer.data(), static_cast<int>(buffer.size()));
+    }
+    
+    void LogFormatJson::formatTo(fmt::memory_buffer &parBuffer, const LogMessage &parLogMessage) const
+    {
+        const bool pretty_print = (options.prettyPrint && !options.jsonLines);
+        
+        ::JsonWriter writer(parBuffer, pretty_print);
+        ::writeJsonObject(writer, parLogMessage, options.omitEmpty);
+        
+        if (options.jsonLines)
+        {
+            parBuffer.push_back('\n');
+            return;
+        }
+        
+        parBuffer.push_back(',');
+        
+        if (pretty_print)
+        {
+            const std::string_view new_line = juce::newLine.getDefault();
+            parBuffer.append(new_line.data(), new_line.data() + new_line.size());
+        }
+    }
+    
+    void LogFormatJson::formatEventTo(fmt::memory_buffer &parBuffer, const LogMessage &parLogMessage) const
+    {
+        ::JsonWriter writer(parBuffer, options.prettyPrint);
+        ::writeJsonObject(writer, parLogMessage, options.omitEmpty);
     }
     
     juce::String LogFormatJson::formatReplace(const jaut::LogMessage &parLogMessage, const juce::String &parContent)
     {
         juce::String output;
-        juce::var    new_object = ::createJsonObject(parLogMessage);
+        juce::var    new_object = ::createJsonObject(parLogMessage, options.omitEmpty);
         
         if (!options.shouldCache)
         {
@@ -175,6 +424,38 @@ namespace jaut
         return failedJson + output + (options.prettyPrint ? juce::newLine.getDefault() : "");
     }
     
+    std::optional<ILogFormat::DocumentLayout> LogFormatJson::openDocument(const juce::String &parContent) const
+    {
+        const juce::String new_line = (options.prettyPrint ? juce::newLine.getDefault() : "");
+        
+        DocumentLayout layout;
+        layout.head      = "[" + new_line;
+        layout.separator = "," + new_line;
+        layout.closing   = new_line + "]" + new_line;
+        
+        if (parContent.trim().isEmpty())
+        {
+            return layout;
+        }
+        
+        juce::String    failed_content;
+        const juce::var events = ::prepareObject(parContent, (options.tryPreserveInvalidLog ? &failed_content : nullptr),
+                                                 options.prettyPrint);
+        
+        if (events.getArray()->isEmpty())
+        {
+            layout.head = failed_content + layout.head;
+        }
+        else
+        {
+            const juce::String output = juce::JSON::toString(events, !options.prettyPrint);
+            layout.head      = failed_content + output.upToLastOccurrenceOf("]", false, false).trimEnd();
+            layout.hasEvents = true;
+        }
+        
+        return layout;
+    }
+    
     //==================================================================================================================
     bool LogFormatJson::supportsReplacingFormatter() const noexcept
     {
@@ -55,6 +55,9 @@ namespace jaut
      *  the log file will not be valid json anymore.
      *  <br><br>
      *  The replacing formatter will output proper valid json depending on the content of the current log file.
+     *  <br><br>
+     *  The appending formatter writes the json directly into the output without building an intermediate object
+     *  tree, with Options::jsonLines it can also be used to output <a href="https://jsonlines.org">JSON Lines</a>.
      */
     class JAUT_API LogFormatJson : public ILogFormat
     {
@@ -63,6 +66,8 @@ namespace jaut
         static constexpr bool default_prettify                 = true;
         static constexpr bool default_tryPreserveInvalidLog    = true;
         static constexpr bool default_shouldCache              = true;
+        static constexpr bool default_jsonLines                = false;
+        static constexpr bool default_omitEmpty                = false;
         
         //==============================================================================================================
         struct Options
@@ -99,6 +104,21 @@ namespace jaut
              *  This is only important when the replacing formatter is used and has no use for the appending version.
              */
             bool shouldCache = default_shouldCache;
+            
+            /**
+             *  Determines whether the appending formatter should output JSON Lines (NDJSON).<br>
+             *  If this is true, every event will be written as a single line json object terminated by a new line,
+             *  regardless of prettyPrint.
+             *  <br><br>
+             *  This is only important when the appending formatter is used and has no use for the replacing version.
+             */
+            bool jsonLines = default_jsonLines;
+            
+            /**
+             *  Determines whether the "exception" property should be omitted if no exception was thrown
+             *  and whether the "fields" property should be omitted if no fields were attached to the event.
+             */
+            bool omitEmpty = default_omitEmpty;
         };
         
         //==============================================================================================================
@@ -115,9 +135,16 @@ namespace jaut
         JAUT_NODISCARD
         juce::String format(const LogMessage &logMessage) const override;
         
+        void formatTo(fmt::memory_buffer &buffer, const LogMessage &logMessage) const override;
+        
+        void formatEventTo(fmt::memory_buffer &buffer, const LogMessage &logMessage) const override;
+        
         JAUT_NODISCARD
         juce::String formatReplace(const jaut::LogMessage &logMessage, const juce::String &content) override;
         
+        JAUT_NODISCARD
+        std::optional<DocumentLayout> openDocument(const juce::String &content) const override;
+        
         //==============================================================================================================
         JAUT_NODISCARD
         bool supportsReplacingFormatter() const noexcept override;
@@ -39,6 +39,84 @@
 
 
 
+//**********************************************************************************************************************
+// region Namespace
+//======================================================================================================================
+namespace
+{
+    //==================================================================================================================
+    bool isIdentifier(std::string_view name) noexcept
+    {
+        if (name.empty() || !(std::isalpha(static_cast<unsigned char>(name.front())) || name.front() == '_'))
+        {
+            return false;
+        }
+        
+        return std::all_of(name.begin(), name.end(), [](char c)
+        {
+            return (std::isalnum(static_cast<unsigned char>(c)) || c == '_');
+        });
+    }
+    
+    //==================================================================================================================
+    void appendString(fmt::memory_buffer &buffer, const std::string &spec, std::string_view value)
+    {
+        if (spec.empty())
+        {
+            buffer.append(value.data(), value.data() + value.size());
+        }
+        else
+        {
+            fmt::vformat_to(std::back_inserter(buffer), fmt::string_view(spec), fmt::make_format_args(value));
+        }
+    }
+    
+    void appendString(fmt::memory_buffer &buffer, const std::string &spec, const juce::String &value)
+    {
+        appendString(buffer, spec, std::string_view(value.toRawUTF8(), value.getNumBytesAsUTF8()));
+    }
+    
+    template<class T>
+    void appendValue(fmt::memory_buffer &buffer, const std::string &spec, const T &value)
+    {
+        fmt::vformat_to(std::back_inserter(buffer), fmt::string_view(spec.empty() ? "{}" : spec),
+                        fmt::make_format_args(value));
+    }
+    
+    void appendTime(fmt::memory_buffer            &buffer,
+                    const std::string             &spec,
+                    std::time_t                    time,
+                    jaut::LogTimestampCache::Zone  zone,
+                    jaut::LogTimestampCache       *cache,
+                    std::size_t                    slot)
+    {
+        if (cache)
+        {
+            appendString(buffer, {}, cache->format(slot, time, zone, spec));
+        }
+        else if (zone == jaut::LogTimestampCache::Zone::Utc)
+        {
+            appendValue(buffer, spec, fmt::gmtime(time));
+        }
+        else
+        {
+            appendValue(buffer, spec, fmt::localtime(time));
+        }
+    }
+    
+    JAUT_NODISCARD
+    std::tm getCalendarTime(std::time_t time, jaut::LogTimestampCache::Zone zone, jaut::LogTimestampCache *cache)
+    {
+        if (cache)
+        {
+            return cache->toCalendarTime(time, zone);
+        }
+        
+        return (zone == jaut::LogTimestampCache::Zone::Utc ? fmt::gmtime(time) : fmt::localtime(time));
+    }
+}
+//======================================================================================================================
+// endregion Namespace
 //**********************************************************************************************************************
 // region LogFormatPattern
 //======================================================================================================================
@@ -46,20 +124,288 @@ namespace jaut
 {
     //==================================================================================================================
     LogFormatPattern::LogFormatPattern(juce::String parPattern, juce::String parExceptionPattern)
-        : pattern(std::move(parPattern)),
-          exceptionPattern(std::move(parExceptionPattern))
+        : pattern                 (std::move(parPattern)),
+          exceptionPattern        (std::move(parExceptionPattern)),
+          compiledPattern         (compilePattern(pattern, 0)),
+          compiledExceptionPattern(compilePattern(exceptionPattern, compiledPattern.endTimeSlot))
     {}
     
     //==================================================================================================================
     juce::String LogFormatPattern::format(const LogMessage &parLogMessage) const
+    {
+        fmt::memory_buffer buffer;
+        formatTo(buffer, parLogMessage);
+        
+        return juce::String::fromUTF8(buffer.data(), static_cast<int>(buffer.size()));
+    }
+    
+    void LogFormatPattern::formatTo(fmt::memory_buffer &parBuffer, const LogMessage &parLogMessage) const
+    {
+        const bool             has_exception = parLogMessage.exception.has_value();
+        const CompiledPattern &compiled      = (has_exception ? compiledExceptionPattern : compiledPattern);
+        
+        // Formatters are usually not shared between sinks, but if they are and another sink is formatting right now,
+        // we'd rather format the time again than wait for it
+        const juce::SpinLock::ScopedTryLockType lock(timestampLock);
+        LogTimestampCache *const cache = (lock.isLocked() ? &timestampCache : nullptr);
+        
+        if (compiled.compiled)
+        {
+            formatCompiled(parBuffer, compiled, parLogMessage, cache);
+        }
+        else
+        {
+            formatRuntime(parBuffer, (has_exception ? exceptionPattern : pattern), parLogMessage, cache);
+        }
+        
+        const std::string_view new_line = juce::NewLine::getDefault();
+        parBuffer.append(new_line.data(), new_line.data() + new_line.size());
+    }
+    
+    //==================================================================================================================
+    bool LogFormatPattern::supportsReplacingFormatter() const
+    {
+        return false;
+    }
+    
+    //==================================================================================================================
+    LogFormatPattern::CompiledPattern LogFormatPattern::compilePattern(const juce::String &parPattern,
+                                                                       std::size_t         parFirstTimeSlot)
+    {
+        using Type = Segment::Type;
+        
+        static const std::unordered_map<std::string_view, Type> key_map {
+            { "name",   Type::Name             },
+            { "msg",    Type::Message          },
+            { "t_id",   Type::ThreadId         },
+            { "t_name", Type::ThreadName       },
+            { "t_ref",  Type::ThreadRef        },
+            { "time_g", Type::TimeUtc          },
+            { "time_l", Type::TimeLocal        },
+            { "level",  Type::Level            },
+            { "ex_id",  Type::ExceptionId      },
+            { "ex_msg", Type::ExceptionMessage }
+        };
+        
+        const std::string_view text(parPattern.toRawUTF8(), parPattern.getNumBytesAsUTF8());
+        CompiledPattern        result;
+        std::string            literal;
+        
+        result.endTimeSlot = parFirstTimeSlot;
+        
+        const auto push_literal = [&result, &literal]()
+        {
+            if (!literal.empty())
+            {
+                result.segments.push_back({ std::move(literal), {}, Type::Literal });
+                literal.clear();
+            }
+        };
+        
+        for (std::size_t i = 0; i < text.size(); ++i)
+        {
+            const char c = text[i];
+            
+            if (c == '}')
+            {
+                // A lone closing brace is an error, leave it to fmt to report it
+                if (i + 1 >= text.size() || text[i + 1] != '}')
+                {
+                    return {};
+                }
+                
+                literal += '}';
+                ++i;
+                continue;
+            }
+            
+            if (c != '{')
+            {
+                literal += c;
+                continue;
+            }
+            
+            if (i + 1 < text.size() && text[i + 1] == '{')
+            {
+                literal += '{';
+                ++i;
+                continue;
+            }
+            
+            const std::size_t close = text.find('}', i + 1);
+            
+            if (close == std::string_view::npos)
+            {
+                return {};
+            }
+            
+            const std::string_view field = text.substr(i + 1, close - i - 1);
+            
+            // Nested replacement fields can't be resolved ahead of time
+            if (field.find('{') != std::string_view::npos)
+            {
+                return {};
+            }
+            
+            const std::size_t      colon = field.find(':');
+            const std::string_view key   = field.substr(0, colon);
+            
+            // Only named arguments are supported, positional arguments wouldn't make sense here anyway
+            if (!isIdentifier(key))
+            {
+                return {};
+            }
+            
+            push_literal();
+            
+            Segment segment { {}, {}, Type::Field };
+            
+            if (colon != std::string_view::npos)
+            {
+                segment.spec = "{" + std::string(field.substr(colon)) + "}";
+            }
+            
+            if (const auto it = key_map.find(key); it != key_map.end())
+            {
+                segment.type = it->second;
+                
+                if (segment.type == Type::TimeUtc || segment.type == Type::TimeLocal)
+                {
+                    segment.timeSlot = result.endTimeSlot++;
+                }
+            }
+            else
+            {
+                segment.text = std::string(key);
+            }
+            
+            result.segments.push_back(std::move(segment));
+            i = close;
+        }
+        
+        push_literal();
+        result.compiled = true;
+        
+        return result;
+    }
+    
+    void LogFormatPattern::formatCompiled(fmt::memory_buffer    &parBuffer,
+                                          const CompiledPattern &parCompiled,
+                                          const LogMessage      &parMessage,
+                                          LogTimestampCache     *parTimestampCache)
+    {
+        using Type = Segment::Type;
+        
+        static constexpr std::string_view not_available = "n/a";
+        
+        const auto time = static_cast<std::time_t>(parMessage.timestamp.toMilliseconds() / 1000);
+        
+        for (const Segment &segment : parCompiled.segments)
+        {
+            const std::string &spec = segment.spec;
+            
+            switch (segment.type)
+            {
+                case Type::Literal:
+                    parBuffer.append(segment.text.data(), segment.text.data() + segment.text.size());
+                    break;
+                
+                case Type::Name:
+                    appendString(parBuffer, spec, parMessage.name.toString());
+                    break;
+                
+                case Type::Message:
+                    appendString(parBuffer, spec, parMessage.message);
+                    break;
+                
+                case Type::ThreadId:
+                    appendValue(parBuffer, spec, parMessage.threadId);
+                    break;
+                
+                case Type::ThreadName:
+                    appendString(parBuffer, spec, parMessage.threadName.toString());
+                    break;
+                
+                case Type::ThreadRef:
+                    if (parMessage.threadName.isNotEmpty())
+                    {
+                        appendString(parBuffer, spec, parMessage.threadName.toString());
+                    }
+                    else
+                    {
+                        appendValue(parBuffer, spec, parMessage.threadId);
+                    }
+                    
+                    break;
+                
+                case Type::TimeUtc:
+                    appendTime(parBuffer, spec, time, LogTimestampCache::Zone::Utc, parTimestampCache,
+                               segment.timeSlot);
+                    break;
+                
+                case Type::TimeLocal:
+                    appendTime(parBuffer, spec, time, LogTimestampCache::Zone::Local, parTimestampCache,
+                               segment.timeSlot);
+                    break;
+                
+                case Type::Level:
+                    appendString(parBuffer, spec, LogLevel::names[parMessage.level]);
+                    break;
+                
+                case Type::ExceptionId:
+                    if (parMessage.exception.has_value())
+                    {
+                        appendString(parBuffer, spec, parMessage.exception->name);
+                    }
+                    else
+                    {
+                        appendString(parBuffer, spec, not_available);
+                    }
+                    
+                    break;
+                
+                case Type::ExceptionMessage:
+                    if (parMessage.exception.has_value())
+                    {
+                        appendString(parBuffer, spec, parMessage.exception->message);
+                    }
+                    else
+                    {
+                        appendString(parBuffer, spec, not_available);
+                    }
+                    
+                    break;
+                
+                case Type::Field:
+                {
+                    const auto it = std::find_if(parMessage.fields.begin(), parMessage.fields.end(),
+                                                 [&segment](const LogMessage::Field &field)
+                                                 {
+                                                     return (field.name.toString() == segment.text.c_str());
+                                                 });
+                    
+                    if (it == parMessage.fields.end())
+                    {
+                        throw fmt::format_error("argument not found");
+                    }
+                    
+                    appendString(parBuffer, spec, jaut::toString(it->value));
+                    break;
+                }
+            }
+        }
+    }
+    
+    void LogFormatPattern::formatRuntime(fmt::memory_buffer &parBuffer,
+                                         const juce::String &parPattern,
+                                         const LogMessage   &parLogMessage,
+                                         LogTimestampCache  *parTimestampCache)
     {
         using namespace fmt::literals;
         
         const auto             time      = static_cast<std::time_t>(parLogMessage.timestamp.toMilliseconds() / 1000);
         const std::size_t      num_args  = (10 + parLogMessage.fields.size());
-        const std::string_view l_pattern = (parLogMessage.exception.has_value()
-                                                ? exceptionPattern
-                                                : pattern).toRawUTF8();
+        const std::string_view l_pattern = parPattern.toRawUTF8();
         
         fmt::dynamic_format_arg_store<fmt::format_context> args;
         args.reserve(num_args, num_args);
@@ -67,13 +413,14 @@ namespace jaut
         std::stringstream thread_id;
         thread_id << parLogMessage.threadId;
         
-        args.push_back("name"_a   = parLogMessage.name);
+        args.push_back("name"_a   = parLogMessage.name.toString());
         args.push_back("msg"_a    = parLogMessage.message);
         args.push_back("t_id"_a   = thread_id.str());
-        args.push_back("t_name"_a = parLogMessage.threadName);
-        args.push_back("t_ref"_a  = (!parLogMessage.threadName.isEmpty() ? parLogMessage.threadName : thread_id.str()));
-        args.push_back("time_g"_a = fmt::gmtime   (time));
-        args.push_back("time_l"_a = fmt::localtime(time));
+        args.push_back("t_name"_a = parLogMessage.threadName.toString());
+        args.push_back("t_ref"_a  = (parLogMessage.threadName.isNotEmpty() ? parLogMessage.threadName.toString()
+                                                                            : juce::String(thread_id.str())));
+        args.push_back("time_g"_a = getCalendarTime(time, LogTimestampCache::Zone::Utc,   parTimestampCache));
+        args.push_back("time_l"_a = getCalendarTime(time, LogTimestampCache::Zone::Local, parTimestampCache));
         args.push_back("level"_a  = LogLevel::names[parLogMessage.level]);
         
         if (parLogMessage.exception.has_value())
@@ -89,16 +436,11 @@ namespace jaut
         
         for (const auto &[name, value] : parLogMessage.fields)
         {
-            args.push_back(fmt::arg(name.toRawUTF8(), jaut::toString(value)));
+            // Symbol names live in the symbol table and never move, so the pointer stays valid
+            args.push_back(fmt::arg(name.toString().toRawUTF8(), jaut::toString(value)));
         }
         
-        return (fmt::vformat(l_pattern, args) + juce::newLine);
-    }
-    
-    //==================================================================================================================
-    bool LogFormatPattern::supportsReplacingFormatter() const
-    {
-        return false;
+        fmt::vformat_to(std::back_inserter(parBuffer), l_pattern, args);
     }
 }
 //======================================================================================================================
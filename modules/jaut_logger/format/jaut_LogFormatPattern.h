@@ -34,6 +34,7 @@
 
 #pragma once
 
+#include <jaut_logger/jaut_LogClock.h>
 #include <jaut_logger/format/jaut_ILogFormat.h>
 
 #include <jaut_core/define/jaut_Define.h>
@@ -67,6 +68,13 @@ namespace jaut
      *      <li>fd_{field name}: The name of a field that was attached to the log event</li>
      *      <li>Any other fmt included formatting key, found <a href="https://fmt.dev/dev/syntax.html">here</a></li>
      *  </ul>
+     *  
+     *  The patterns are compiled once on construction, so that only the keys that are actually used by a pattern
+     *  are evaluated for a log event.<br>
+     *  Patterns that can't be compiled, for example if they use positional arguments or nested replacement fields,
+     *  will be formatted at runtime the old-fashioned way.
+     *  <br><br>
+     *  Formatted timestamps are cached per second, so that time_g and time_l only need to be formatted once a second.
      */
     class JAUT_API LogFormatPattern : public ILogFormat
     {
@@ -85,13 +93,72 @@ namespace jaut
         JAUT_NODISCARD
         juce::String format(const LogMessage &logMessage) const override;
         
+        void formatTo(fmt::memory_buffer &buffer, const LogMessage &logMessage) const override;
+        
         //==============================================================================================================
         JAUT_NODISCARD
         bool supportsReplacingFormatter() const override;
         
     private:
-        juce::String pattern;
-        juce::String exceptionPattern;
+        struct Segment
+        {
+            enum class Type
+            {
+                Literal,
+                Name,
+                Message,
+                ThreadId,
+                ThreadName,
+                ThreadRef,
+                TimeUtc,
+                TimeLocal,
+                Level,
+                ExceptionId,
+                ExceptionMessage,
+                Field
+            };
+            
+            //==========================================================================================================
+            /** The literal text for literals, or the field name for fields. */
+            std::string text;
+            
+            /** The fmt replacement field to format the value with, or empty if the value can be copied as is. */
+            std::string spec;
+            
+            Type type;
+            
+            /** The slot in the timestamp cache for time segments. */
+            std::size_t timeSlot { 0 };
+        };
+        
+        struct CompiledPattern
+        {
+            std::vector<Segment> segments;
+            std::size_t          endTimeSlot { 0 };
+            bool                 compiled    { false };
+        };
+        
+        //==============================================================================================================
+        static CompiledPattern compilePattern(const juce::String &pattern, std::size_t firstTimeSlot);
+        
+        static void formatCompiled(fmt::memory_buffer    &buffer,
+                                   const CompiledPattern &compiled,
+                                   const LogMessage      &message,
+                                   LogTimestampCache     *timestampCache);
+        
+        static void formatRuntime(fmt::memory_buffer &buffer,
+                                  const juce::String &pattern,
+                                  const LogMessage   &message,
+                                  LogTimestampCache  *timestampCache);
+        
+        //==============================================================================================================
+        juce::String    pattern;
+        juce::String    exceptionPattern;
+        CompiledPattern compiledPattern;
+        CompiledPattern compiledExceptionPattern;
+        
+        mutable LogTimestampCache timestampCache;
+        mutable juce::SpinLock    timestampLock;
         
         //==============================================================================================================
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LogFormatPattern)
@@ -45,9 +45,9 @@ namespace
     std::unique_ptr<juce::XmlElement> createXmlObject(const jaut::LogMessage &logMessage)
     {
         auto root_obj = std::make_unique<juce::XmlElement>("Event");
-        root_obj->createNewChildElement("Name")      ->addTextElement(logMessage.name);
+        root_obj->createNewChildElement("Name")      ->addTextElement(logMessage.name.toString());
         root_obj->createNewChildElement("Message")   ->addTextElement(logMessage.message);
-        root_obj->createNewChildElement("ThreadName")->addTextElement(logMessage.threadName);
+        root_obj->createNewChildElement("ThreadName")->addTextElement(logMessage.threadName.toString());
         root_obj->createNewChildElement("ThreadId")  ->addTextElement(jaut::toString(logMessage.threadId));
         root_obj->createNewChildElement("Timestamp") ->addTextElement(juce::String(logMessage.timestamp.toMilliseconds()));
         
@@ -68,7 +68,7 @@ namespace
         {
             juce::XmlElement *const field_obj = fields_obj->createNewChildElement("Field");
             field_obj->addTextElement(field.value);
-            field_obj->setAttribute("name", field.name);
+            field_obj->setAttribute("name", field.name.toString());
         }
         
         return root_obj;
@@ -160,6 +160,36 @@ namespace jaut
         return (failedXml + output + juce::newLine);
     }
     
+    std::optional<ILogFormat::DocumentLayout> LogFormatXml::openDocument(const juce::String &parContent) const
+    {
+        DocumentLayout layout;
+        layout.head    = juce::String("<?xml version=\"1.0\" encoding=\"UTF-8\"?>") + juce::newLine
+                             + juce::newLine + "<Log>" + juce::newLine;
+        layout.closing = juce::String("</Log>") + juce::newLine;
+        
+        if (parContent.trim().isEmpty())
+        {
+            return layout;
+        }
+        
+        juce::String                            failed_content;
+        const std::unique_ptr<juce::XmlElement> events
+            = ::prepareObject(parContent, (options.tryPreserveInvalidLog ? &failed_content : nullptr));
+        
+        if (events->getNumChildElements() == 0)
+        {
+            layout.head = failed_content + layout.head;
+        }
+        else
+        {
+            const juce::String output = events->toString();
+            layout.head      = failed_content + output.upToLastOccurrenceOf("</Log>", false, false);
+            layout.hasEvents = true;
+        }
+        
+        return layout;
+    }
+    
     //==================================================================================================================
     bool LogFormatXml::supportsReplacingFormatter() const noexcept
     {
@@ -112,6 +112,9 @@ namespace jaut
         JAUT_NODISCARD
         juce::String formatReplace(const jaut::LogMessage &logMessage, const juce::String &content) override;
         
+        JAUT_NODISCARD
+        std::optional<DocumentLayout> openDocument(const juce::String &content) const override;
+        
         //==============================================================================================================
         JAUT_NODISCARD
         bool supportsReplacingFormatter() const noexcept override;
@@ -68,9 +68,18 @@ namespace jaut
 {
     //==================================================================================================================
     AbstractLogger::LogBuilder::LogBuilder(AbstractLogger &parLogger, LogLevel::Value parLevel)
-        : logger(parLogger),
-          logMessage(parLogger.makeLog((parLogger.shouldLog(parLevel) ? parLevel : LogLevel::Off), ""))
-    {}
+        : logger(parLogger)
+    {
+        // A disabled builder doesn't need a timestamp or thread info, it will be thrown away anyway
+        if (parLogger.shouldLog(parLevel))
+        {
+            logMessage = parLogger.makeLog(parLevel, "");
+        }
+        else
+        {
+            logMessage.level = LogLevel::Off;
+        }
+    }
     
     AbstractLogger::LogBuilder::~LogBuilder()
     {
@@ -106,59 +115,134 @@ namespace jaut
     }
     
     //==================================================================================================================
-    void AbstractLogger::trace  (const juce::String &parMessage) { log(makeLog(Level::Trace,   parMessage)); }
-    void AbstractLogger::debug  (const juce::String &parMessage) { log(makeLog(Level::Debug,   parMessage)); }
-    void AbstractLogger::verbose(const juce::String &parMessage) { log(makeLog(Level::Verbose, parMessage)); }
-    void AbstractLogger::info   (const juce::String &parMessage) { log(makeLog(Level::Info,    parMessage)); }
-    void AbstractLogger::warn   (const juce::String &parMessage) { log(makeLog(Level::Warn,    parMessage)); }
-    void AbstractLogger::error  (const juce::String &parMessage) { log(makeLog(Level::Error,   parMessage)); }
-    void AbstractLogger::fatal  (const juce::String &parMessage) { log(makeLog(Level::Fatal,   parMessage)); }
+    void AbstractLogger::trace(const juce::String &parMessage)
+    {
+        if (shouldLog(Level::Trace))
+        {
+            log(makeLog(Level::Trace, parMessage));
+        }
+    }
+    
+    void AbstractLogger::debug(const juce::String &parMessage)
+    {
+        if (shouldLog(Level::Debug))
+        {
+            log(makeLog(Level::Debug, parMessage));
+        }
+    }
+    
+    void AbstractLogger::verbose(const juce::String &parMessage)
+    {
+        if (shouldLog(Level::Verbose))
+        {
+            log(makeLog(Level::Verbose, parMessage));
+        }
+    }
+    
+    void AbstractLogger::info(const juce::String &parMessage)
+    {
+        if (shouldLog(Level::Info))
+        {
+            log(makeLog(Level::Info, parMessage));
+        }
+    }
+    
+    void AbstractLogger::warn(const juce::String &parMessage)
+    {
+        if (shouldLog(Level::Warn))
+        {
+            log(makeLog(Level::Warn, parMessage));
+        }
+    }
+    
+    void AbstractLogger::error(const juce::String &parMessage)
+    {
+        if (shouldLog(Level::Error))
+        {
+            log(makeLog(Level::Error, parMessage));
+        }
+    }
+    
+    void AbstractLogger::fatal(const juce::String &parMessage)
+    {
+        if (shouldLog(Level::Fatal))
+        {
+            log(makeLog(Level::Fatal, parMessage));
+        }
+    }
     
     void AbstractLogger::trace(const juce::String &parMessage, const std::exception &parException)
     {
-        log(makeLog(Level::Trace, parMessage, {}, LogMessage::ExceptionSpec::fromException(parException)));
+        if (shouldLog(Level::Trace))
+        {
+            log(makeLog(Level::Trace, parMessage, {}, LogMessage::ExceptionSpec::fromException(parException)));
+        }
     }
     
     void AbstractLogger::debug(const juce::String &parMessage, const std::exception &parException)
     {
-        log(makeLog(Level::Debug, parMessage, {}, LogMessage::ExceptionSpec::fromException(parException)));
+        if (shouldLog(Level::Debug))
+        {
+            log(makeLog(Level::Debug, parMessage, {}, LogMessage::ExceptionSpec::fromException(parException)));
+        }
     }
     
     void AbstractLogger::verbose(const juce::String &parMessage, const std::exception &parException)
     {
-        log(makeLog(Level::Verbose, parMessage, {}, LogMessage::ExceptionSpec::fromException(parException)));
+        if (shouldLog(Level::Verbose))
+        {
+            log(makeLog(Level::Verbose, parMessage, {}, LogMessage::ExceptionSpec::fromException(parException)));
+        }
     }
     
     void AbstractLogger::info(const juce::String &parMessage, const std::exception &parException)
     {
-        log(makeLog(Level::Info, parMessage, {}, LogMessage::ExceptionSpec::fromException(parException)));
+        if (shouldLog(Level::Info))
+        {
+            log(makeLog(Level::Info, parMessage, {}, LogMessage::ExceptionSpec::fromException(parException)));
+        }
     }
     
     void AbstractLogger::warn(const juce::String &parMessage, const std::exception &parException)
     {
-        log(makeLog(Level::Warn, parMessage, {}, LogMessage::ExceptionSpec::fromException(parException)));
+        if (shouldLog(Level::Warn))
+        {
+            log(makeLog(Level::Warn, parMessage, {}, LogMessage::ExceptionSpec::fromException(parException)));
+        }
     }
     
     void AbstractLogger::error(const juce::String &parMessage, const std::exception &parException)
     {
-        log(makeLog(Level::Error, parMessage, {}, LogMessage::ExceptionSpec::fromException(parException)));
+        if (shouldLog(Level::Error))
+        {
+            log(makeLog(Level::Error, parMessage, {}, LogMessage::ExceptionSpec::fromException(parException)));
+        }
     }
     
     void AbstractLogger::fatal(const juce::String &parMessage, const std::exception &parException)
     {
-        log(makeLog(Level::Fatal, parMessage, {}, LogMessage::ExceptionSpec::fromException(parException)));
+        if (shouldLog(Level::Fatal))
+        {
+            log(makeLog(Level::Fatal, parMessage, {}, LogMessage::ExceptionSpec::fromException(parException)));
+        }
+    }
+    
+    //==================================================================================================================
+    void AbstractLogger::logRecord(LogRecord parRecord)
+    {
+        log(parRecord.message ? std::move(*parRecord.message) : parRecord.toMessage(nameSymbol));
     }
     
     //==================================================================================================================
     void AbstractLogger::setLogLevel(Level parLogLevel) noexcept
     {
-        logLevel.store(parLogLevel);
+        logLevel.store(parLogLevel, std::memory_order_relaxed);
     }
     
     //==================================================================================================================
     AbstractLogger::Level AbstractLogger::getLogLevel() const noexcept
     {
-        return logLevel.load();
+        return logLevel.load(std::memory_order_relaxed);
     }
     
     const juce::String& AbstractLogger::getName() const noexcept
@@ -166,14 +250,14 @@ namespace jaut
         return name;
     }
     
-    const std::vector<AbstractLogger::SinkPtr>& AbstractLogger::getSinks() const noexcept
+    LogSymbol AbstractLogger::getNameSymbol() const noexcept
     {
-        return sinks;
+        return nameSymbol;
     }
     
-    bool AbstractLogger::shouldLog(Level parLogLevel) const noexcept
+    const std::vector<AbstractLogger::SinkPtr>& AbstractLogger::getSinks() const noexcept
     {
-        return !(parLogLevel == Level::Off || parLogLevel < getLogLevel());
+        return sinks;
     }
     
     //==================================================================================================================
@@ -182,16 +266,14 @@ namespace jaut
                                              std::vector<jaut::LogMessage::Field>     fields,
                                              std::optional<LogMessage::ExceptionSpec> ex)
     {
+        const LogThreadTable::Entry &thread = LogThreadTable::getCurrentThread();
+        
         jaut::LogMessage log_message;
-        log_message.name      = getName();
-        log_message.timestamp = juce::Time::getCurrentTime();
-        log_message.level     = level;
-        log_message.threadId  = std::this_thread::get_id();
-
-        if (const juce::Thread *c_thread = juce::Thread::getCurrentThread())
-        {
-            log_message.threadName = c_thread->getThreadName();
-        }
+        log_message.name       = nameSymbol;
+        log_message.timestamp  = LogClock::now();
+        log_message.level      = level;
+        log_message.threadId   = thread.threadId;
+        log_message.threadName = thread.threadName;
         
         std::swap(log_message.fields,  fields);
         std::swap(log_message.message, message);
@@ -34,6 +34,7 @@
  
 #pragma once
 
+#include <jaut_logger/jaut_LogRecord.h>
 #include <jaut_logger/detail/jaut_fmt.h>
 #include <jaut_logger/format/jaut_ILogFormat.h>
 
@@ -44,6 +45,55 @@
 
 
 
+//======================================================================================================================
+/**
+ *  Logs a message with the given level, but only evaluates the arguments if the logger would log it.<br>
+ *  If the level is below JAUT_LOGGER_MIN_LEVEL, the call will be compiled out entirely, otherwise a disabled call
+ *  costs a single relaxed atomic load.
+ *  <br><br>
+ *  You would usually use the level specific JAUT_LOG_<LEVEL> macros instead.
+ *  
+ *  @code
+ *  JAUT_LOG(logger, Debug, debug, "x={}, y={}", computeX(), computeY());
+ *  @endcode
+ */
+#define JAUT_LOG(LOGGER, LEVEL, METHOD, ...)                                                                    \
+    do                                                                                                          \
+    {                                                                                                           \
+        if constexpr (::jaut::LogLevel::LEVEL >= ::jaut::LogLevel::JAUT_LOGGER_MIN_LEVEL)                       \
+        {                                                                                                       \
+            auto &&jaut_logger_ref = (LOGGER);                                                                  \
+                                                                                                                \
+            if (jaut_logger_ref.shouldLog(::jaut::LogLevel::LEVEL))                                             \
+            {                                                                                                   \
+                jaut_logger_ref.METHOD(__VA_ARGS__);                                                            \
+            }                                                                                                   \
+        }                                                                                                       \
+    }                                                                                                           \
+    while (false)
+
+/** Logs a trace message, see JAUT_LOG for more details. */
+#define JAUT_LOG_TRACE(LOGGER, ...)   JAUT_LOG(LOGGER, Trace,   trace,   __VA_ARGS__)
+
+/** Logs a debug message, see JAUT_LOG for more details. */
+#define JAUT_LOG_DEBUG(LOGGER, ...)   JAUT_LOG(LOGGER, Debug,   debug,   __VA_ARGS__)
+
+/** Logs a verbose message, see JAUT_LOG for more details. */
+#define JAUT_LOG_VERBOSE(LOGGER, ...) JAUT_LOG(LOGGER, Verbose, verbose, __VA_ARGS__)
+
+/** Logs an info message, see JAUT_LOG for more details. */
+#define JAUT_LOG_INFO(LOGGER, ...)    JAUT_LOG(LOGGER, Info,    info,    __VA_ARGS__)
+
+/** Logs a warning message, see JAUT_LOG for more details. */
+#define JAUT_LOG_WARN(LOGGER, ...)    JAUT_LOG(LOGGER, Warn,    warn,    __VA_ARGS__)
+
+/** Logs an error message, see JAUT_LOG for more details. */
+#define JAUT_LOG_ERROR(LOGGER, ...)   JAUT_LOG(LOGGER, Error,   error,   __VA_ARGS__)
+
+/** Logs a fatal message, see JAUT_LOG for more details. */
+#define JAUT_LOG_FATAL(LOGGER, ...)   JAUT_LOG(LOGGER, Fatal,   fatal,   __VA_ARGS__)
+
+//======================================================================================================================
 namespace jaut
 {
     //==================================================================================================================
@@ -63,6 +113,9 @@ namespace jaut
         
         template<class ...Args>
         inline constexpr bool FmtEnableIfCheck_v = FmtEnableIfCheck<Args...>::value;
+        
+        template<class Format>
+        inline constexpr bool IsCompiledFormat_v = fmt::detail::is_compiled_string<Format>::value;
     }
     
     //==================================================================================================================
@@ -307,6 +360,111 @@ namespace jaut
         template<class ...Args, std::enable_if_t<detail::FmtEnableIfCheck_v<Args...>>* = nullptr>
         void fatal(const juce::String &message, Args &&...args);
         
+        /**
+         *  Logs a message with the trace level.<br>
+         *  This will format the passed objects with the supplied compile-time format string via fmt.
+         *  (see JAUT_FMT)
+         *  
+         *  @param format The compiled format string
+         *  @param args   The objects to format the message with
+         */
+        template<class Format, class ...Args, std::enable_if_t<detail::IsCompiledFormat_v<Format>>* = nullptr>
+        void trace(const Format &format, Args &&...args);
+        
+        /**
+         *  Logs a message with the debug level.<br>
+         *  This will format the passed objects with the supplied compile-time format string via fmt.
+         *  (see JAUT_FMT)
+         *  
+         *  @param format The compiled format string
+         *  @param args   The objects to format the message with
+         */
+        template<class Format, class ...Args, std::enable_if_t<detail::IsCompiledFormat_v<Format>>* = nullptr>
+        void debug(const Format &format, Args &&...args);
+        
+        /**
+         *  Logs a message with the verbose level.<br>
+         *  This will format the passed objects with the supplied compile-time format string via fmt.
+         *  (see JAUT_FMT)
+         *  
+         *  @param format The compiled format string
+         *  @param args   The objects to format the message with
+         */
+        template<class Format, class ...Args, std::enable_if_t<detail::IsCompiledFormat_v<Format>>* = nullptr>
+        void verbose(const Format &format, Args &&...args);
+        
+        /**
+         *  Logs a message with the info level.<br>
+         *  This will format the passed objects with the supplied compile-time format string via fmt.
+         *  (see JAUT_FMT)
+         *  
+         *  @param format The compiled format string
+         *  @param args   The objects to format the message with
+         */
+        template<class Format, class ...Args, std::enable_if_t<detail::IsCompiledFormat_v<Format>>* = nullptr>
+        void info(const Format &format, Args &&...args);
+        
+        /**
+         *  Logs a message with the warn level.<br>
+         *  This will format the passed objects with the supplied compile-time format string via fmt.
+         *  (see JAUT_FMT)
+         *  
+         *  @param format The compiled format string
+         *  @param args   The objects to format the message with
+         */
+        template<class Format, class ...Args, std::enable_if_t<detail::IsCompiledFormat_v<Format>>* = nullptr>
+        void warn(const Format &format, Args &&...args);
+        
+        /**
+         *  Logs a message with the error level.<br>
+         *  This will format the passed objects with the supplied compile-time format string via fmt.
+         *  (see JAUT_FMT)
+         *  
+         *  @param format The compiled format string
+         *  @param args   The objects to format the message with
+         */
+        template<class Format, class ...Args, std::enable_if_t<detail::IsCompiledFormat_v<Format>>* = nullptr>
+        void error(const Format &format, Args &&...args);
+        
+        /**
+         *  Logs a message with the fatal level.<br>
+         *  This will format the passed objects with the supplied compile-time format string via fmt.
+         *  (see JAUT_FMT)
+         *  
+         *  @param format The compiled format string
+         *  @param args   The objects to format the message with
+         */
+        template<class Format, class ...Args, std::enable_if_t<detail::IsCompiledFormat_v<Format>>* = nullptr>
+        void fatal(const Format &format, Args &&...args);
+        
+        //==============================================================================================================
+        /**
+         *  Logs a message with the given level, deferring the formatting to whoever processes the message.<br>
+         *  This only captures the pattern and a raw copy of the arguments in a jaut::LogRecord, so that the calling
+         *  thread doesn't have to allocate anything.
+         *  <br><br>
+         *  The pattern must be a compiled format string (see JAUT_FMT), which can only be made from a string literal,
+         *  so it is guaranteed to outlive the record.
+         *  <br><br>
+         *  If the arguments can't be deferred (see jaut::LogRecord::canDefer) the message will be formatted right
+         *  away like with the other formatting log methods.
+         *  The same happens if the logger's worker can't handle records, in which case the record will be rendered
+         *  before handing it to the worker.
+         *  
+         *  @param level  The level of the log message
+         *  @param format The compiled format string
+         *  @param args   The objects to format the message with
+         */
+        template<class Format, class ...Args, std::enable_if_t<detail::IsCompiledFormat_v<Format>>* = nullptr>
+        void logDeferred(Level level, const Format &format, const Args &...args);
+        
+        /**
+         *  Plain strings can't be deferred, since a character array might not outlive the record.<br>
+         *  Wrap the pattern in JAUT_FMT instead.
+         */
+        template<std::size_t N, class ...Args>
+        void logDeferred(Level level, const char (&pattern)[N], const Args &...args) = delete;
+        
         //==============================================================================================================
         /**
          *  Sets the current log level to be used.
@@ -332,6 +490,13 @@ namespace jaut
         JAUT_NODISCARD
         const juce::String& getName() const noexcept;
         
+        /**
+         *  Gets the name of the logger as interned symbol, this is what the logger's messages carry.
+         *  @return The logger name symbol
+         */
+        JAUT_NODISCARD
+        LogSymbol getNameSymbol() const noexcept;
+        
         /**
          *  Gets the sink objects the logger has.
          *  @return The sink object list
@@ -340,7 +505,9 @@ namespace jaut
         const std::vector<SinkPtr>& getSinks() const noexcept;
         
         /**
-         *  Determines whether the logger should log based on the given level.
+         *  Determines whether the logger should log based on the given level.<br>
+         *  This is a single relaxed atomic load, so it is cheap enough to guard call sites with,
+         *  see JAUT_LOG.
          *  
          *  @param logLevel The level to check
          *  @return True if should be logged
@@ -358,6 +525,15 @@ namespace jaut
          */
         virtual void log(LogMessage message) = 0;
         
+        /**
+         *  Logs a record.<br>
+         *  By default, this renders the record right away and logs it like a normal message, loggers whose worker
+         *  supports deferred records should override this.
+         *  
+         *  @param record The record to be logged
+         */
+        virtual void logRecord(LogRecord record);
+        
     protected:
         /**
          *  Handles exceptions inside flushing destructors.<br>
@@ -371,6 +547,7 @@ namespace jaut
     private:
         std::vector<SinkPtr> sinks;
         juce::String         name;
+        LogSymbol            nameSymbol;
         std::atomic<Level>   logLevel;
         
         //==============================================================================================================
@@ -379,10 +556,10 @@ namespace jaut
                                  std::vector<jaut::LogMessage::Field>     fields = {},
                                  std::optional<LogMessage::ExceptionSpec> ex     = std::nullopt);
         
-        template<class ...Args>
-        void makeFormatCall(LogLevel::Value    level,
-                            const juce::String &message,
-                            Args               &&...args);
+        template<class Formatter, class ...Args>
+        void makeFormatCall(LogLevel::Value level,
+                            Formatter       formatter,
+                            Args            &&...args);
     };
     
     //==================================================================================================================
@@ -390,6 +567,7 @@ namespace jaut
     template<class ...Sinks>
     inline AbstractLogger::AbstractLogger(juce::String parName, Level parLogLevel, Sinks ...parSinks)
         : name(std::move(parName)),
+          nameSymbol(name),
           logLevel(parLogLevel)
     {
         static_assert(((sameTypeIgnoreTemplate_v<std::unique_ptr, Sinks>
@@ -399,6 +577,12 @@ namespace jaut
         ((void) sinks.emplace_back(std::move(parSinks)), ...);
     }
     
+    //==================================================================================================================
+    inline bool AbstractLogger::shouldLog(Level parLogLevel) const noexcept
+    {
+        return (parLogLevel != Level::Off && parLogLevel >= logLevel.load(std::memory_order_relaxed));
+    }
+    
     //==================================================================================================================
     template<class T>
     inline AbstractLogger::LogBuilder& AbstractLogger::LogBuilder::operator<<(T &&parObject)
@@ -428,43 +612,92 @@ namespace jaut
     template<class ...Args, std::enable_if_t<detail::FmtEnableIfCheck_v<Args...>>*>
     inline void AbstractLogger::trace(const juce::String &parMessage, Args &&...parArgs)
     {
-        makeFormatCall(Level::Trace, parMessage, std::forward<Args>(parArgs)...);
+        makeFormatCall(Level::Trace, detail::FormatArgProcessor{parMessage}, std::forward<Args>(parArgs)...);
     }
     
     template<class ...Args, std::enable_if_t<detail::FmtEnableIfCheck_v<Args...>>*>
     inline void AbstractLogger::debug(const juce::String &parMessage, Args &&...parArgs)
     {
-        makeFormatCall(Level::Debug, parMessage, std::forward<Args>(parArgs)...);
+        makeFormatCall(Level::Debug, detail::FormatArgProcessor{parMessage}, std::forward<Args>(parArgs)...);
     }
     
     template<class ...Args, std::enable_if_t<detail::FmtEnableIfCheck_v<Args...>>*>
     inline void AbstractLogger::verbose(const juce::String &parMessage, Args &&...parArgs)
     {
-        makeFormatCall(Level::Verbose, parMessage, std::forward<Args>(parArgs)...);
+        makeFormatCall(Level::Verbose, detail::FormatArgProcessor{parMessage}, std::forward<Args>(parArgs)...);
     }
     
     template<class ...Args, std::enable_if_t<detail::FmtEnableIfCheck_v<Args...>>*>
     inline void AbstractLogger::info(const juce::String &parMessage, Args &&...parArgs)
     {
-        makeFormatCall(Level::Info, parMessage, std::forward<Args>(parArgs)...);
+        makeFormatCall(Level::Info, detail::FormatArgProcessor{parMessage}, std::forward<Args>(parArgs)...);
     }
     
     template<class ...Args, std::enable_if_t<detail::FmtEnableIfCheck_v<Args...>>*>
     inline void AbstractLogger::warn(const juce::String &parMessage, Args &&...parArgs)
     {
-        makeFormatCall(Level::Warn, parMessage, std::forward<Args>(parArgs)...);
+        makeFormatCall(Level::Warn, detail::FormatArgProcessor{parMessage}, std::forward<Args>(parArgs)...);
     }
     
     template<class ...Args, std::enable_if_t<detail::FmtEnableIfCheck_v<Args...>>*>
     inline void AbstractLogger::error(const juce::String &parMessage, Args &&...parArgs)
     {
-        makeFormatCall(Level::Error, parMessage, std::forward<Args>(parArgs)...);
+        makeFormatCall(Level::Error, detail::FormatArgProcessor{parMessage}, std::forward<Args>(parArgs)...);
     }
     
     template<class ...Args, std::enable_if_t<detail::FmtEnableIfCheck_v<Args...>>*>
     inline void AbstractLogger::fatal(const juce::String &parMessage, Args &&...parArgs)
     {
-        makeFormatCall(Level::Fatal, parMessage, std::forward<Args>(parArgs)...);
+        makeFormatCall(Level::Fatal, detail::FormatArgProcessor{parMessage}, std::forward<Args>(parArgs)...);
+    }
+    
+    template<class Format, class ...Args, std::enable_if_t<detail::IsCompiledFormat_v<Format>>*>
+    inline void AbstractLogger::trace(const Format &parFormat, Args &&...parArgs)
+    {
+        makeFormatCall(Level::Trace, detail::CompiledFormatArgProcessor<Format>{parFormat},
+                       std::forward<Args>(parArgs)...);
+    }
+    
+    template<class Format, class ...Args, std::enable_if_t<detail::IsCompiledFormat_v<Format>>*>
+    inline void AbstractLogger::debug(const Format &parFormat, Args &&...parArgs)
+    {
+        makeFormatCall(Level::Debug, detail::CompiledFormatArgProcessor<Format>{parFormat},
+                       std::forward<Args>(parArgs)...);
+    }
+    
+    template<class Format, class ...Args, std::enable_if_t<detail::IsCompiledFormat_v<Format>>*>
+    inline void AbstractLogger::verbose(const Format &parFormat, Args &&...parArgs)
+    {
+        makeFormatCall(Level::Verbose, detail::CompiledFormatArgProcessor<Format>{parFormat},
+                       std::forward<Args>(parArgs)...);
+    }
+    
+    template<class Format, class ...Args, std::enable_if_t<detail::IsCompiledFormat_v<Format>>*>
+    inline void AbstractLogger::info(const Format &parFormat, Args &&...parArgs)
+    {
+        makeFormatCall(Level::Info, detail::CompiledFormatArgProcessor<Format>{parFormat},
+                       std::forward<Args>(parArgs)...);
+    }
+    
+    template<class Format, class ...Args, std::enable_if_t<detail::IsCompiledFormat_v<Format>>*>
+    inline void AbstractLogger::warn(const Format &parFormat, Args &&...parArgs)
+    {
+        makeFormatCall(Level::Warn, detail::CompiledFormatArgProcessor<Format>{parFormat},
+                       std::forward<Args>(parArgs)...);
+    }
+    
+    template<class Format, class ...Args, std::enable_if_t<detail::IsCompiledFormat_v<Format>>*>
+    inline void AbstractLogger::error(const Format &parFormat, Args &&...parArgs)
+    {
+        makeFormatCall(Level::Error, detail::CompiledFormatArgProcessor<Format>{parFormat},
+                       std::forward<Args>(parArgs)...);
+    }
+    
+    template<class Format, class ...Args, std::enable_if_t<detail::IsCompiledFormat_v<Format>>*>
+    inline void AbstractLogger::fatal(const Format &parFormat, Args &&...parArgs)
+    {
+        makeFormatCall(Level::Fatal, detail::CompiledFormatArgProcessor<Format>{parFormat},
+                       std::forward<Args>(parArgs)...);
     }
     
     //==================================================================================================================
@@ -506,28 +739,88 @@ namespace jaut
             }
         };
         
+        JAUT_NODISCARD
+        inline juce::String toJuceString(const fmt::memory_buffer &buffer)
+        {
+            return juce::String::fromUTF8(buffer.data(), static_cast<int>(buffer.size()));
+        }
+        
         class FormatArgProcessor
         {
         public:
             explicit FormatArgProcessor(const juce::String &parPattern) noexcept
-                : pattern(parPattern.toStdString())
+                : pattern(parPattern.toRawUTF8())
+            {}
+            
+            explicit FormatArgProcessor(const char *parPattern) noexcept
+                : pattern(parPattern)
+            {}
+            
+            //==========================================================================================================
+            template<class ...Args>
+            juce::String operator()(Args &&...parArgs)
+            {
+                fmt::memory_buffer buffer;
+                fmt::vformat_to(std::back_inserter(buffer), fmt::string_view(pattern), fmt::make_format_args(parArgs...));
+                return toJuceString(buffer);
+            }
+            
+        private:
+            // The pattern is guaranteed to outlive the processor, so we don't need to copy it
+            const char *pattern;
+        };
+        
+        template<class Format>
+        class CompiledFormatArgProcessor
+        {
+        public:
+            explicit CompiledFormatArgProcessor(const Format &parFormat) noexcept
+                : format(parFormat)
             {}
             
             //==========================================================================================================
             template<class ...Args>
             juce::String operator()(Args &&...parArgs)
             {
-                return fmt::format(pattern, std::forward<Args>(parArgs)...);
+                fmt::memory_buffer buffer;
+                fmt::format_to(std::back_inserter(buffer), format, std::forward<Args>(parArgs)...);
+                return toJuceString(buffer);
             }
             
         private:
-            std::string pattern;
+            Format format;
         };
     }
     
-    template<class ...Args>
-    inline void AbstractLogger::makeFormatCall(LogLevel::Value level, const juce::String &message, Args &&...args)
+    template<class Format, class ...Args, std::enable_if_t<detail::IsCompiledFormat_v<Format>>*>
+    inline void AbstractLogger::logDeferred(Level parLevel, const Format &parFormat, const Args &...parArgs)
     {
+        if (!shouldLog(parLevel))
+        {
+            return;
+        }
+        
+        if constexpr (LogRecord::canDefer<Args...>)
+        {
+            // A compiled format string always views a string literal, which is null-terminated and lives forever
+            const fmt::string_view pattern(parFormat);
+            logRecord(LogRecord::create(parLevel, pattern.data(), parArgs...));
+        }
+        else
+        {
+            makeFormatCall(parLevel, detail::CompiledFormatArgProcessor<Format>{parFormat}, parArgs...);
+        }
+    }
+    
+    template<class Formatter, class ...Args>
+    inline void AbstractLogger::makeFormatCall(LogLevel::Value level, Formatter formatter, Args &&...args)
+    {
+        // No need to format anything that would be thrown away by log() anyway
+        if (!shouldLog(level))
+        {
+            return;
+        }
+        
         using Filter = ArgFilter<
             PredicateOr<
                 std::is_same<std::decay_t<PType<>>, LogMessage::Field>,
@@ -539,7 +832,7 @@ namespace jaut
         using Result = detail::FilterArgProcessor::Result;
         
         Result       result = Filter::invokeFiltered(detail::FilterArgProcessor{},        std::forward<Args>(args)...);
-        juce::String text   = Filter::invokeExcluded(detail::FormatArgProcessor{message}, std::forward<Args>(args)...);
+        juce::String text   = Filter::invokeExcluded(std::move(formatter),                   std::forward<Args>(args)...);
         
         log(makeLog(level, std::move(text), std::move(result.fields), std::move(result.exceptionSpec)));
     }
@@ -36,8 +36,12 @@
 
 #include <jaut_logger/jaut_AbstractLogger.h>
 #include <jaut_logger/jaut_FlushPolicy.h>
+#include <jaut_logger/jaut_OverflowPolicy.h>
 #include <jaut_logger/worker/jaut_LogWorkerAsync.h>
+#include <jaut_logger/worker/jaut_LogWorkerDeferred.h>
+#include <jaut_logger/worker/jaut_LogWorkerParallel.h>
 #include <jaut_logger/worker/jaut_LogWorkerSimple.h>
+#include <jaut_logger/worker/jaut_LogWorkerThreadLocal.h>
 
 #include <jaut_core/define/jaut_DefUtils.h>
 #include <jaut_core/util/jaut_CommonUtils.h>
@@ -50,6 +54,35 @@
 
 namespace jaut
 {
+    //==================================================================================================================
+    namespace detail
+    {
+        template<class Worker, class = void>
+        struct WorkerSupportsRecords : std::false_type {};
+        
+        template<class Worker>
+        struct WorkerSupportsRecords<Worker, std::void_t<decltype(std::declval<Worker&>().enqueue(LogRecord{})),
+                                                         decltype(std::declval<Worker&>().tryFlush(LogRecord{}))>>
+            : std::true_type
+        {};
+        
+        template<class Worker>
+        inline constexpr bool WorkerSupportsRecords_v = WorkerSupportsRecords<Worker>::value;
+        
+        //==============================================================================================================
+        JAUT_NODISCARD
+        inline LogLevel::Value getMessageLevel(const LogMessage &message) noexcept
+        {
+            return message.level;
+        }
+        
+        JAUT_NODISCARD
+        inline LogLevel::Value getMessageLevel(const LogRecord &record) noexcept
+        {
+            return record.getLevel();
+        }
+    }
+    
     //==================================================================================================================
     /**
      *  A proper logging implementation that aims at being a bit more advanced than the juce native one.
@@ -80,6 +113,9 @@ namespace jaut
             /** Determines the flushing behaviour of the logger.*/
             FlushPolicy::Settings flushPolicySettings;
             
+            /** Determines what happens to messages when the buffer of the worker is full. */
+            OverflowPolicy::Settings overflowPolicySettings;
+            
             /**
              *  This event occurs when a vital exception was thrown inside a destructor.<br>
              *  This might happen in the log message builder or when the logger gets destructed and need to make a
@@ -102,7 +138,8 @@ namespace jaut
             
             /**
              *  The amount of milliseconds a log message should be retried to be enqueued when the buffer is full.<br>
-             *  This only makes sense when using an async worker or there is an interval specified.
+             *  This only makes sense when using an async worker or there is an interval specified and is only used
+             *  by OverflowPolicy::Retry.
              *  <br><br>
              *  If this is -1, it will block until it could enqueue the message<br>
              *  If this is 0, it will try it once<br>
@@ -146,6 +183,15 @@ namespace jaut
         //==============================================================================================================
         void log(LogMessage logMessage) override;
         
+        /**
+         *  Logs a record.<br>
+         *  If the worker supports records, like jaut::LogWorkerDeferred, the record will be handed to it as is.
+         *  Otherwise, it will be rendered right away.
+         *  
+         *  @param record The record to be logged
+         */
+        void logRecord(LogRecord record) override;
+        
         //==============================================================================================================
         void flush() override;
         
@@ -171,13 +217,42 @@ namespace jaut
         JAUT_NODISCARD
         const ILogWorker& getWorker() const noexcept;
         
+        /**
+         *  Gets a snapshot of the counters for messages that were affected by the overflow policy.
+         *  @return The overflow statistics
+         */
+        JAUT_NODISCARD
+        OverflowPolicy::Statistics getOverflowStatistics() const noexcept;
+        
     private:
+        using Counter = std::atomic<std::uint64_t>;
+        
+        //==============================================================================================================
         Options options;
         Worker  worker;
         
+        Counter droppedNewest { 0 };
+        Counter droppedOldest { 0 };
+        Counter sampledOut    { 0 };
+        Counter timedOut      { 0 };
+        Counter blocked       { 0 };
+        
         //==============================================================================================================
         void handleException(const std::exception &exception) const override;
         
+        //==============================================================================================================
+        template<class Message>
+        void logInternal(Message &message);
+        
+        template<class Message>
+        void handleOverflow(Message &message, ILogWorker::FlushAttemptResult flushResult);
+        
+        template<class Message>
+        bool retryEnqueue(Message &message, ILogWorker::FlushAttemptResult flushResult);
+        
+        template<class Message>
+        bool blockEnqueue(Message &message);
+        
         //==============================================================================================================
         void flushInternal();
         void handleExceptionInternal(const std::exception &exception) const;
@@ -219,33 +294,86 @@ namespace jaut
     
     /**
      *  The default sync logger, this will make message processing happen on the same thread as the logging.<br>
-     *  This variant will give you a sync logger with a default buffer size of 512 and a lock on the producer site.
+     *  This variant will give you a sync logger with a default buffer size of 512 and a lock-free multi-producer
+     *  buffer, the lock will only be taken by the thread flushing the buffer.
      */
-    using LoggerSimpleMT = BasicLogger<LogWorkerSimple<512, juce::CriticalSection>>;
+    using LoggerSimpleMT = BasicLogger<LogWorkerSimple<512, juce::CriticalSection, MpscRingBuffer>>;
     
     /**
      *  The async logger, this will create a separate thread that will process the logging messages asynchronously.<br>
-     *  This variant will give you an async logger with a default buffer size of 512 and a lock on the producer site.
+     *  This variant will give you an async logger with a default buffer size of 512 and a lock-free multi-producer
+     *  buffer.
      */
-    using LoggerAsyncMT = BasicLogger<LogWorkerAsync<512, juce::CriticalSection>>;
+    using LoggerAsyncMT = BasicLogger<LogWorkerAsync<512, juce::DummyCriticalSection, MpscRingBuffer>>;
     
     /**
      *  The default sync logger, this will make message processing happen on the same thread as the logging.<br>
-     *  This variant will give you a sync logger with a custom buffer size and a lock on the producer site.
+     *  This variant will give you a sync logger with a custom buffer size and a lock-free multi-producer buffer,
+     *  the lock will only be taken by the thread flushing the buffer.
      *  
      *  @tparam BufferSize The size of the log worker message buffer
      */
     template<int BufferSize>
-    using LoggerSimpleCSMT = BasicLogger<LogWorkerSimple<BufferSize, juce::CriticalSection>>;
+    using LoggerSimpleCSMT = BasicLogger<LogWorkerSimple<BufferSize, juce::CriticalSection, MpscRingBuffer>>;
     
     /**
      *  The async logger, this will create a separate thread that will process the logging messages asynchronously.<br>
-     *  This variant will give you an async logger with a custom buffer size and a lock on the producer site.
+     *  This variant will give you an async logger with a custom buffer size and a lock-free multi-producer buffer.
      *  
      *  @tparam BufferSize The size of the log worker message buffer
      */
     template<int BufferSize>
-    using LoggerAsyncCSMT = BasicLogger<LogWorkerAsync<BufferSize, juce::CriticalSection>>;
+    using LoggerAsyncCSMT = BasicLogger<LogWorkerAsync<BufferSize, juce::DummyCriticalSection, MpscRingBuffer>>;
+    
+    /**
+     *  The deferred logger, an async logger that hands log records to its worker-thread without rendering them.<br>
+     *  Use AbstractLogger::logDeferred() to make use of this, normal log calls will work just like with LoggerAsyncMT.
+     *  This variant will give you a deferred logger with a buffer size of 512 and a lock-free multi-producer buffer.
+     */
+    using LoggerDeferred = BasicLogger<LogWorkerDeferred<>>;
+    
+    /**
+     *  The deferred logger, an async logger that hands log records to its worker-thread without rendering them.<br>
+     *  This variant will give you a deferred logger with a custom buffer size and a lock-free multi-producer buffer.
+     *  
+     *  @tparam BufferSize The size of the log worker record buffer
+     */
+    template<int BufferSize>
+    using LoggerDeferredCS = BasicLogger<LogWorkerDeferred<BufferSize>>;
+    
+    /**
+     *  The parallel logger, an async logger that prints to every sink on a separate thread.<br>
+     *  Slow sinks will only hold back themselves, batches they can't keep up with will be dropped for them and
+     *  counted, see LogWorkerParallel::getLaneStatistics().
+     *  This variant will give you a parallel logger with a buffer size of 512 and a lock-free multi-producer buffer.
+     */
+    using LoggerParallelMT = BasicLogger<LogWorkerParallel<512, juce::DummyCriticalSection, MpscRingBuffer>>;
+    
+    /**
+     *  The parallel logger, an async logger that prints to every sink on a separate thread.<br>
+     *  This variant will give you a parallel logger with a custom buffer size and a lock-free multi-producer buffer.
+     *  
+     *  @tparam BufferSize The size of the log worker message buffer
+     */
+    template<int BufferSize>
+    using LoggerParallelCSMT = BasicLogger<LogWorkerParallel<BufferSize, juce::DummyCriticalSection, MpscRingBuffer>>;
+    
+    /**
+     *  The thread-local logger, a synchronous logger for many threads that gives every thread its own buffer.<br>
+     *  Threads never wait for another thread's sinks, whoever flushes while another thread is already flushing
+     *  leaves its messages to that thread, see jaut::LogWorkerThreadLocal.
+     *  This variant will give you a thread-local logger with a buffer size of 512 per thread.
+     */
+    using LoggerSimpleTL = BasicLogger<LogWorkerThreadLocal<>>;
+    
+    /**
+     *  The thread-local logger, a synchronous logger for many threads that gives every thread its own buffer.<br>
+     *  This variant will give you a thread-local logger with a custom buffer size per thread.
+     *  
+     *  @tparam BufferSize The size of the log worker message buffer of every thread
+     */
+    template<int BufferSize>
+    using LoggerSimpleTLCS = BasicLogger<LogWorkerThreadLocal<BufferSize>>;
     
     //==================================================================================================================
     // IMPLEMENTATION BasicLogger
@@ -286,82 +414,229 @@ namespace jaut
             return;
         }
         
+        logInternal(parLogMessage);
+    }
+    
+    template<class T>
+    void BasicLogger<T>::logRecord(LogRecord parRecord)
+    {
+        if constexpr (detail::WorkerSupportsRecords_v<T>)
+        {
+            if (!shouldLog(parRecord.getLevel()))
+            {
+                return;
+            }
+            
+            logInternal(parRecord);
+        }
+        else
+        {
+            AbstractLogger::logRecord(std::move(parRecord));
+        }
+    }
+    
+    //==================================================================================================================
+    template<class T>
+    template<class Message>
+    void BasicLogger<T>::logInternal(Message &parLogMessage)
+    {
         const bool                           queue_result = worker.enqueue (parLogMessage);
         const ILogWorker::FlushAttemptResult flush_result = worker.tryFlush(parLogMessage);
         
         if (!queue_result)
         {
-            switch (flush_result)
+            // I have no clue how you got here, honestly
+            // It should be pretty much impossible to get here except you did something really weird,
+            // or you implemented your own worker returning this despite having been initialised at this point
+            if (flush_result == ILogWorker::FlushAttemptResult::NotReady)
             {
-                case ILogWorker::FlushAttemptResult::Successful:
+                jassertfalse;
+                return;
+            }
+            
+            handleOverflow(parLogMessage, flush_result);
+        }
+    }
+    
+    template<class T>
+    template<class Message>
+    void BasicLogger<T>::handleOverflow(Message &parLogMessage, ILogWorker::FlushAttemptResult parFlushResult)
+    {
+        const OverflowPolicy::Settings &settings = options.overflowPolicySettings;
+        
+        if (settings.policy == OverflowPolicy::Retry)
+        {
+            if (!retryEnqueue(parLogMessage, parFlushResult))
+            {
+                droppedNewest.fetch_add(1, std::memory_order_relaxed);
+            }
+            
+            return;
+        }
+        
+        // If the worker just made room, there is nothing the policy needs to decide on
+        if (parFlushResult == ILogWorker::FlushAttemptResult::Successful && worker.enqueue(parLogMessage))
+        {
+            return;
+        }
+        
+        switch (settings.policy)
+        {
+            case OverflowPolicy::DropOldest:
+            {
+                if constexpr (std::is_same_v<Message, LogMessage>)
+                {
+                    if (worker.enqueueReplacingOldest(parLogMessage))
+                    {
+                        droppedOldest.fetch_add(1, std::memory_order_relaxed);
+                        break;
+                    }
+                }
+                
+                JAUT_FALLTHROUGH;
+            }
+            
+            case OverflowPolicy::DropNewest:
+            {
+                droppedNewest.fetch_add(1, std::memory_order_relaxed);
+                break;
+            }
+            
+            case OverflowPolicy::Sample:
+            {
+                thread_local juce::Random random;
+                
+                if (   detail::getMessageLevel(parLogMessage) < settings.protectedLevel
+                    && random.nextDouble() >= settings.sampleRate)
                 {
-                    (void) worker.enqueue(parLogMessage);
+                    sampledOut.fetch_add(1, std::memory_order_relaxed);
                     break;
                 }
                 
-                case ILogWorker::FlushAttemptResult::Unsuccessful:
+                JAUT_FALLTHROUGH;
+            }
+            
+            case OverflowPolicy::Block:
+            {
+                if (!blockEnqueue(parLogMessage))
                 {
-                    if (options.flushPolicySettings.policies.test(FlushPolicy::Timed))
-                    {
-                        break;
-                    }
-                    
-                    JAUT_FALLTHROUGH;
+                    timedOut.fetch_add(1, std::memory_order_relaxed);
                 }
                 
-                case ILogWorker::FlushAttemptResult::Async:
+                break;
+            }
+            
+            case OverflowPolicy::Retry: break;
+        }
+    }
+    
+    template<class T>
+    template<class Message>
+    bool BasicLogger<T>::retryEnqueue(Message &parLogMessage, ILogWorker::FlushAttemptResult parFlushResult)
+    {
+        switch (parFlushResult)
+        {
+            case ILogWorker::FlushAttemptResult::Successful: return worker.enqueue(parLogMessage);
+            
+            case ILogWorker::FlushAttemptResult::Unsuccessful:
+            {
+                if (options.flushPolicySettings.policies.test(FlushPolicy::Timed))
+                {
+                    return false;
+                }
+                
+                JAUT_FALLTHROUGH;
+            }
+            
+            case ILogWorker::FlushAttemptResult::Async:
+            {
+                const int timeout = options.bufferOverflowRetryTimeout;
+                
+                if (timeout < 0)
                 {
-                    const int timeout = options.bufferOverflowRetryTimeout;
+                    // Do note that this is a dangerous combination for the reasons explained in the docs
+                    // for jaut::Logger::Options::bufferOverflowRetryTimeout
+                    jassert(!options.flushPolicySettings.policies.test(FlushPolicy::Levelled));
                     
-                    if (timeout < 0)
+                    while (!worker.enqueue(parLogMessage))
                     {
-                        // Do note that this is a dangerous combination for the reasons explained in the docs
-                        // for jaut::Logger::Options::bufferOverflowRetryTimeout
-                        jassert(!options.flushPolicySettings.policies.test(FlushPolicy::Levelled));
-                        
-                        while (!worker.enqueue(parLogMessage))
+                        if (parFlushResult != ILogWorker::FlushAttemptResult::Async)
                         {
-                            if (flush_result != ILogWorker::FlushAttemptResult::Async)
-                            {
-                                (void) worker.tryFlush(parLogMessage);
-                            }
+                            (void) worker.tryFlush(parLogMessage);
                         }
                     }
-                    else if (timeout > 0)
+                    
+                    return true;
+                }
+                else if (timeout > 0)
+                {
+                    using Clock     = std::chrono::steady_clock;
+                    using TimePoint = std::chrono::time_point<Clock>;
+                    
+                    using std::chrono::duration_cast;
+                    
+                    const TimePoint start = Clock::now();
+                    
+                    while (duration_cast<std::chrono::milliseconds>(Clock::now() - start).count() < timeout)
                     {
-                        using Clock     = std::chrono::steady_clock;
-                        using TimePoint = std::chrono::time_point<Clock>;
+                        if (worker.enqueue(parLogMessage))
+                        {
+                            return true;
+                        }
                         
-                        using std::chrono::duration_cast;
-    
-                        const TimePoint start = Clock::now();
-    
-                        while (duration_cast<std::chrono::milliseconds>(Clock::now() - start).count() < timeout)
+                        if (parFlushResult != ILogWorker::FlushAttemptResult::Async)
                         {
-                            if (worker.enqueue(parLogMessage))
-                            {
-                                break;
-                            }
-        
-                            if (flush_result != ILogWorker::FlushAttemptResult::Async)
-                            {
-                                (void) worker.tryFlush(parLogMessage);
-                            }
+                            (void) worker.tryFlush(parLogMessage);
                         }
                     }
-                    else if (flush_result != ILogWorker::FlushAttemptResult::Unsuccessful)
-                    {
-                        (void) worker.enqueue(parLogMessage);
-                    }
-    
-                    break;
                 }
+                else if (parFlushResult != ILogWorker::FlushAttemptResult::Unsuccessful)
+                {
+                    return worker.enqueue(parLogMessage);
+                }
+                
+                return false;
+            }
+            
+            case ILogWorker::FlushAttemptResult::NotReady: break;
+        }
+        
+        return false;
+    }
+    
+    template<class T>
+    template<class Message>
+    bool BasicLogger<T>::blockEnqueue(Message &parLogMessage)
+    {
+        using Clock     = std::chrono::steady_clock;
+        using TimePoint = std::chrono::time_point<Clock>;
         
-                    // I have no clue how you got here, honestly
-                    // It should be pretty much impossible to get here except you did something really weird,
-                    // or you implemented your own worker returning this despite having been initialised at this point
-                case ILogWorker::FlushAttemptResult::NotReady: jassertfalse;
+        const OverflowPolicy::Settings &settings = options.overflowPolicySettings;
+        
+        const TimePoint start       = Clock::now();
+        const auto      timeout     = std::chrono::milliseconds(settings.blockTimeout);
+        const auto      max_backoff = std::chrono::microseconds(std::max(1, settings.maxBackoff));
+        auto            backoff     = std::chrono::microseconds(1);
+        
+        blocked.fetch_add(1, std::memory_order_relaxed);
+        
+        for (;;)
+        {
+            // For sync workers this drains the buffer right away, async workers will be woken up to do it for us
+            (void) worker.flush();
+            
+            if (worker.enqueue(parLogMessage))
+            {
+                return true;
             }
+            
+            if (settings.blockTimeout >= 0 && (Clock::now() - start) >= timeout)
+            {
+                return false;
+            }
+            
+            std::this_thread::sleep_for(backoff);
+            backoff = std::min(backoff * 2, max_backoff);
         }
     }
     
@@ -391,6 +666,19 @@ namespace jaut
         return worker;
     }
     
+    template<class T>
+    OverflowPolicy::Statistics BasicLogger<T>::getOverflowStatistics() const noexcept
+    {
+        OverflowPolicy::Statistics statistics;
+        statistics.droppedNewest = droppedNewest.load(std::memory_order_relaxed);
+        statistics.droppedOldest = droppedOldest.load(std::memory_order_relaxed);
+        statistics.sampledOut    = sampledOut   .load(std::memory_order_relaxed);
+        statistics.timedOut      = timedOut     .load(std::memory_order_relaxed);
+        statistics.blocked       = blocked      .load(std::memory_order_relaxed);
+        
+        return statistics;
+    }
+    
     //==================================================================================================================
     template<class T>
     void BasicLogger<T>::handleException(const std::exception &parException) const
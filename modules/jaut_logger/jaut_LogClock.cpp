@@ -0,0 +1,203 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogClock.cpp
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+#include <jaut_logger/jaut_LogClock.h>
+
+#include <jaut_logger/detail/jaut_fmt.h>
+
+#include <atomic>
+#include <chrono>
+
+
+
+//**********************************************************************************************************************
+// region Namespace
+//======================================================================================================================
+namespace
+{
+    JAUT_NODISCARD
+    juce::int64 getSteadyMillis() noexcept
+    {
+        using namespace std::chrono;
+        return duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+    }
+    
+    //==================================================================================================================
+    struct ClockState
+    {
+        std::atomic<juce::int64> offset   { 0 };
+        std::atomic<juce::int64> lastSync { 0 };
+        
+        //==============================================================================================================
+        ClockState() noexcept
+        {
+            sync(getSteadyMillis());
+        }
+        
+        //==============================================================================================================
+        void sync(juce::int64 steadyMillis) noexcept
+        {
+            // Two threads resyncing at once would both capture about the same offset, so this needs no lock
+            offset  .store(juce::Time::currentTimeMillis() - steadyMillis, std::memory_order_relaxed);
+            lastSync.store(steadyMillis,                                  std::memory_order_relaxed);
+        }
+    };
+    
+    //==================================================================================================================
+    JAUT_NODISCARD
+    ClockState& getClockState() noexcept
+    {
+        static ClockState state;
+        return state;
+    }
+}
+//======================================================================================================================
+// endregion Namespace
+//**********************************************************************************************************************
+// region LogClock
+//======================================================================================================================
+namespace jaut
+{
+    //==================================================================================================================
+    juce::int64 LogClock::nowMillis() noexcept
+    {
+        ClockState        &state  = getClockState();
+        const juce::int64  steady = getSteadyMillis();
+        
+        if (steady - state.lastSync.load(std::memory_order_relaxed) >= resyncInterval)
+        {
+            state.sync(steady);
+        }
+        
+        return steady + state.offset.load(std::memory_order_relaxed);
+    }
+    
+    juce::Time LogClock::now() noexcept
+    {
+        return juce::Time(nowMillis());
+    }
+    
+    void LogClock::resync() noexcept
+    {
+        getClockState().sync(getSteadyMillis());
+    }
+}
+//======================================================================================================================
+// endregion LogClock
+//**********************************************************************************************************************
+// region LogTimestampCache
+//======================================================================================================================
+namespace jaut
+{
+    //==================================================================================================================
+    const std::tm& LogTimestampCache::toCalendarTime(std::time_t parSeconds, Zone parZone)
+    {
+        CalendarEntry &entry = (parZone == Zone::Utc ? utc : local);
+        
+        if (entry.second != parSeconds)
+        {
+            entry.time   = (parZone == Zone::Utc ? fmt::gmtime(parSeconds) : fmt::localtime(parSeconds));
+            entry.second = parSeconds;
+        }
+        
+        return entry.time;
+    }
+    
+    std::string_view LogTimestampCache::format(std::size_t        parSlot,
+                                               std::time_t        parSeconds,
+                                               Zone               parZone,
+                                               const std::string &parSpec)
+    {
+        if (parSlot >= slots.size())
+        {
+            slots.resize(parSlot + 1);
+        }
+        
+        FormatEntry &entry = slots[parSlot];
+        
+        if (entry.second != parSeconds || entry.zone != parZone || entry.spec != parSpec)
+        {
+            const std::tm &time = toCalendarTime(parSeconds, parZone);
+            
+            fmt::memory_buffer buffer;
+            fmt::vformat_to(std::back_inserter(buffer), fmt::string_view(parSpec.empty() ? "{}" : parSpec),
+                            fmt::make_format_args(time));
+            
+            entry.text.assign(buffer.data(), buffer.size());
+            entry.spec   = parSpec;
+            entry.zone   = parZone;
+            entry.second = parSeconds;
+        }
+        
+        return entry.text;
+    }
+    
+    juce::String LogTimestampCache::toISO8601(juce::int64 parMillis)
+    {
+        if (parMillis < 0)
+        {
+            return juce::Time(parMillis).toISO8601(true);
+        }
+        
+        const auto second = static_cast<std::time_t>(parMillis / 1000);
+        
+        if (second != iso8601Second)
+        {
+            // Everything but the milliseconds stays the same for the whole second, including the UTC offset
+            const juce::String text = juce::Time(static_cast<juce::int64>(second) * 1000).toISO8601(true);
+            const int          dot  = text.indexOfChar('.');
+            
+            if (dot < 0)
+            {
+                return juce::Time(parMillis).toISO8601(true);
+            }
+            
+            iso8601Prefix = text.substring(0, dot + 1);
+            iso8601Suffix = text.substring(dot + 4);
+            iso8601Second = second;
+        }
+        
+        const auto millis    = static_cast<int>(parMillis % 1000);
+        const char digits[3] {
+            static_cast<char>('0' + millis / 100),
+            static_cast<char>('0' + millis / 10 % 10),
+            static_cast<char>('0' + millis % 10)
+        };
+        
+        return iso8601Prefix + juce::String(digits, 3) + iso8601Suffix;
+    }
+}
+//======================================================================================================================
+// endregion LogTimestampCache
+//**********************************************************************************************************************
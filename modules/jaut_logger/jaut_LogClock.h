@@ -0,0 +1,166 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogClock.h
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+#pragma once
+
+#include <jaut_core/define/jaut_Define.h>
+
+#include <juce_core/juce_core.h>
+
+#include <ctime>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+
+namespace jaut
+{
+    //==================================================================================================================
+    /**
+     *  The clock log messages are stamped with.<br>
+     *  Instead of asking the system for the wall-clock time for every message, this reads the monotonic
+     *  std::chrono::steady_clock and adds an offset to the wall-clock, which is captured once and then re-captured
+     *  every resyncInterval milliseconds.
+     *  <br><br>
+     *  This means, adjustments to the system time will only be picked up by the next resync, and timestamps may jump
+     *  by the amount the system time was adjusted when that happens.
+     */
+    class JAUT_API LogClock
+    {
+    public:
+        /** The interval in milliseconds after which the offset to the wall-clock will be re-captured. */
+        static constexpr juce::int64 resyncInterval = 1000;
+        
+        //==============================================================================================================
+        /**
+         *  Gets the current wall-clock time in milliseconds since the epoch.
+         *  @return The current time in milliseconds
+         */
+        JAUT_NODISCARD
+        static juce::int64 nowMillis() noexcept;
+        
+        /**
+         *  Gets the current wall-clock time.
+         *  @return The current time
+         */
+        JAUT_NODISCARD
+        static juce::Time now() noexcept;
+        
+        /** Forces the offset to the wall-clock to be re-captured, for example after the system time has changed. */
+        static void resync() noexcept;
+    };
+    
+    //==================================================================================================================
+    /**
+     *  Caches formatted timestamps of log messages, so that formatters don't need to break down and format the same
+     *  second again for every message they get.<br>
+     *  The cached text is reused as long as the second of the messages doesn't change, for timestamps that show
+     *  milliseconds, only the milliseconds will be patched in.
+     *  <br><br>
+     *  A cache is meant to be owned by a single formatter and is not thread-safe.
+     */
+    class JAUT_API LogTimestampCache
+    {
+    public:
+        /** The time zone to break a timestamp down to. */
+        enum class Zone
+        {
+            Utc,
+            Local
+        };
+        
+        //==============================================================================================================
+        /**
+         *  Breaks the given second down to a calendar time, this is what fmt::gmtime or fmt::localtime would return.
+         *  
+         *  @param seconds The seconds since the epoch
+         *  @param zone    The time zone to break the time down to
+         *  @return The calendar time
+         */
+        JAUT_NODISCARD
+        const std::tm& toCalendarTime(std::time_t seconds, Zone zone);
+        
+        /**
+         *  Formats the given second with an fmt chrono replacement field like "{:%F %T}".<br>
+         *  Every slot caches the last formatted text separately, so that every time field of a pattern can have its
+         *  own slot.
+         *  
+         *  @param slot    The cache slot to use
+         *  @param seconds The seconds since the epoch
+         *  @param zone    The time zone to format the time in
+         *  @param spec    The fmt replacement field, or empty to use the default format
+         *  @return The formatted text, valid until this slot is used again
+         */
+        JAUT_NODISCARD
+        std::string_view format(std::size_t slot, std::time_t seconds, Zone zone, const std::string &spec);
+        
+        /**
+         *  Formats the given time like juce::Time::toISO8601(true) would.
+         *  
+         *  @param millis The milliseconds since the epoch
+         *  @return The formatted text
+         */
+        JAUT_NODISCARD
+        juce::String toISO8601(juce::int64 millis);
+        
+    private:
+        static constexpr std::time_t noSecond = std::numeric_limits<std::time_t>::min();
+        
+        //==============================================================================================================
+        struct CalendarEntry
+        {
+            std::time_t second { noSecond };
+            std::tm     time   {};
+        };
+        
+        struct FormatEntry
+        {
+            std::time_t second { noSecond };
+            Zone        zone   { Zone::Utc };
+            std::string spec;
+            std::string text;
+        };
+        
+        //==============================================================================================================
+        CalendarEntry            utc;
+        CalendarEntry            local;
+        std::vector<FormatEntry> slots;
+        
+        juce::String iso8601Prefix;
+        juce::String iso8601Suffix;
+        std::time_t  iso8601Second { noSecond };
+    };
+}
@@ -34,7 +34,9 @@
 
 #pragma once
 
+#include <jaut_logger/jaut_LogClock.h>
 #include <jaut_logger/jaut_LogLevel.h>
+#include <jaut_logger/jaut_LogSymbol.h>
 
 #include <jaut_core/define/jaut_Define.h>
 #include <jaut_core/util/jaut_Stringable.h>
@@ -53,8 +55,8 @@ namespace jaut
         /** A tag denoting some sort of information for the entry. */
         struct Field
         {
-            /** The name of the tag. */
-            juce::String name;
+            /** The name of the tag, interned in the jaut::LogSymbolTable. */
+            LogSymbol name;
             
             /** The content of the tag. */
             juce::var value;
@@ -81,11 +83,11 @@ namespace jaut
         /** The actual log message. */
         juce::String message;
         
-        /** The logger name. */
-        juce::String name;
+        /** The logger name, interned in the jaut::LogSymbolTable. */
+        LogSymbol name;
         
-        /** The name of the thread or empty if no name was set. */
-        juce::String threadName;
+        /** The name of the thread or empty if no name was set, interned in the jaut::LogSymbolTable. */
+        LogSymbol threadName;
         
         /** The id of the thread. */
         std::thread::id threadId;
@@ -129,7 +131,7 @@ namespace jaut
         JAUT_NODISCARD
         static juce::String toString(const LogMessage::Field &obj)
         {
-            return "{name=" + obj.name + ", value=" + jaut::toString(obj.value) + '}';
+            return "{name=" + obj.name.toString() + ", value=" + jaut::toString(obj.value) + '}';
         }
         
         JAUT_NODISCARD
@@ -169,13 +171,15 @@ namespace jaut
             std::stringstream thread_id;
             thread_id << obj.threadId;
             
+            static thread_local LogTimestampCache timestamp_cache;
+            
             return "{fields="     + jaut::toString(obj.fields)
                 + ", exception="  + exception_string
                 + ", message="    + obj.message
-                + ", name="       + obj.name
-                + ", threadName=" + obj.threadName
+                + ", name="       + obj.name.toString()
+                + ", threadName=" + obj.threadName.toString()
                 + ", threadId="   + thread_id.str()
-                + ", timestamp="  + obj.timestamp.toISO8601(true) + " ("
+                + ", timestamp="  + timestamp_cache.toISO8601(obj.timestamp.toMilliseconds()) + " ("
                                   + jaut::toString(obj.timestamp.toMilliseconds()) + ")"
                   ", level="      + jaut::toString(LogLevel::names[obj.level]) + " (Priority: "
                                   + jaut::toString(obj.level) + ")}";
@@ -190,16 +194,37 @@ namespace jaut
     
     //==================================================================================================================
     /**
-     *  Creates a logging field which should be added to the logging message.
+     *  Creates a logging field which should be added to the logging message.<br>
+     *  The prefixed field names are cached per thread, so that logging the same field again doesn't need to build
+     *  its name anew.
+     *  <br><br>
+     *  Field names are interned in the jaut::LogSymbolTable and stay there for the rest of the program, so keys
+     *  should come from a fixed set of names, anything that changes from message to message belongs in the value.
      *  
      *  @param key   The field key
      *  @param value The field value
      *  @return The new field
+     *  
+     *  @throw jaut::LogSymbolException If the key is new and the symbol table is full
      */
     JAUT_NODISCARD
     JAUT_API inline LogMessage::Field mfield(const juce::String &key, juce::var value)
     {
-        return { ("fd_" + key), std::move(value) };
+        static thread_local std::unordered_map<juce::String, LogSymbol, detail::StringHash> names;
+        
+        auto it = names.find(key);
+        
+        if (it == names.end())
+        {
+            if (names.size() >= LogSymbolTable::maxCachedSymbols)
+            {
+                names.clear();
+            }
+            
+            it = names.emplace(key, LogSymbol("fd_" + key)).first;
+        }
+        
+        return { it->second, std::move(value) };
     }
     
     //==================================================================================================================
@@ -0,0 +1,222 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogMetrics.cpp
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+#include <jaut_logger/jaut_LogMetrics.h>
+
+
+
+//**********************************************************************************************************************
+// region Namespace
+//======================================================================================================================
+namespace
+{
+    JAUT_NODISCARD
+    int getHighestBit(std::uint64_t value) noexcept
+    {
+        int bit = 0;
+        
+        for (int step = 32; step > 0; step >>= 1)
+        {
+            if ((value >> step) != 0)
+            {
+                value >>= step;
+                bit    += step;
+            }
+        }
+        
+        return bit;
+    }
+    
+    template<class T>
+    void updateMax(std::atomic<T> &max, T value) noexcept
+    {
+        T current = max.load(std::memory_order_relaxed);
+        
+        while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {}
+    }
+}
+//======================================================================================================================
+// endregion Namespace
+//**********************************************************************************************************************
+// region LogHistogram
+//======================================================================================================================
+namespace jaut
+{
+    //==================================================================================================================
+    void LogHistogram::record(std::uint64_t parValue) noexcept
+    {
+        buckets[static_cast<std::size_t>(getBucketIndex(parValue))].fetch_add(1, std::memory_order_relaxed);
+        
+        count.fetch_add(1,        std::memory_order_relaxed);
+        sum  .fetch_add(parValue, std::memory_order_relaxed);
+        ::updateMax(max, parValue);
+    }
+    
+    void LogHistogram::reset() noexcept
+    {
+        for (Counter &bucket : buckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        
+        count.store(0, std::memory_order_relaxed);
+        sum  .store(0, std::memory_order_relaxed);
+        max  .store(0, std::memory_order_relaxed);
+    }
+    
+    //==================================================================================================================
+    std::uint64_t LogHistogram::getCount() const noexcept
+    {
+        return count.load(std::memory_order_relaxed);
+    }
+    
+    std::uint64_t LogHistogram::getMax() const noexcept
+    {
+        return max.load(std::memory_order_relaxed);
+    }
+    
+    double LogHistogram::getMean() const noexcept
+    {
+        const std::uint64_t num_values = getCount();
+        
+        if (num_values == 0)
+        {
+            return 0.0;
+        }
+        
+        return static_cast<double>(sum.load(std::memory_order_relaxed)) / static_cast<double>(num_values);
+    }
+    
+    std::uint64_t LogHistogram::getValueAtPercentile(double parPercentile) const noexcept
+    {
+        const std::uint64_t num_values = getCount();
+        
+        if (num_values == 0)
+        {
+            return 0;
+        }
+        
+        const double        fraction = (juce::jlimit(0.0, 100.0, parPercentile) / 100.0);
+        const std::uint64_t target   = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(
+                                           std::ceil(fraction * static_cast<double>(num_values))));
+        
+        std::uint64_t total = 0;
+        
+        for (int i = 0; i < numBuckets; ++i)
+        {
+            total += buckets[static_cast<std::size_t>(i)].load(std::memory_order_relaxed);
+            
+            if (total >= target)
+            {
+                return getBucketValue(i);
+            }
+        }
+        
+        // Values have been recorded while we were counting, so the buckets don't add up to the count we read
+        return getMax();
+    }
+    
+    //==================================================================================================================
+    int LogHistogram::getBucketIndex(std::uint64_t parValue) noexcept
+    {
+        if (parValue < static_cast<std::uint64_t>(numSubBuckets))
+        {
+            return static_cast<int>(parValue);
+        }
+        
+        const int shift = (::getHighestBit(parValue) - subBucketBits);
+        const int sub   = static_cast<int>((parValue >> shift) & static_cast<std::uint64_t>(numSubBuckets - 1));
+        
+        return ((shift + 1) * numSubBuckets + sub);
+    }
+    
+    std::uint64_t LogHistogram::getBucketValue(int parIndex) noexcept
+    {
+        jassert(parIndex >= 0 && parIndex < numBuckets);
+        
+        if (parIndex < numSubBuckets)
+        {
+            return static_cast<std::uint64_t>(parIndex);
+        }
+        
+        const int shift = (parIndex / numSubBuckets - 1);
+        const int sub   = (parIndex % numSubBuckets);
+        
+        return (static_cast<std::uint64_t>(numSubBuckets + sub) << shift);
+    }
+}
+//======================================================================================================================
+// endregion LogHistogram
+//**********************************************************************************************************************
+// region LogWorkerMetrics
+//======================================================================================================================
+namespace jaut
+{
+    //==================================================================================================================
+    void LogWorkerMetrics::recordEnqueue(std::uint64_t parLatency, int parSize) noexcept
+    {
+        enqueueLatency.record(parLatency);
+        
+        if (parSize < 0)
+        {
+            overflows.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        
+        ::updateMax(highWaterMark, parSize);
+    }
+    
+    void LogWorkerMetrics::recordPush(std::uint64_t parLatency, int parPosition) noexcept
+    {
+        recordEnqueue(parLatency, (parPosition > -1 ? parPosition + 1 : -1));
+    }
+}
+//======================================================================================================================
+// endregion LogWorkerMetrics
+//**********************************************************************************************************************
+// region LogSinkMetrics
+//======================================================================================================================
+namespace jaut
+{
+    //==================================================================================================================
+    void LogSinkMetrics::recordFormat(std::uint64_t parTime) noexcept
+    {
+        formatTime.record(parTime);
+        messages.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+//======================================================================================================================
+// endregion LogSinkMetrics
+//**********************************************************************************************************************
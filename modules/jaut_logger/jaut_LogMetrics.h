@@ -0,0 +1,261 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogMetrics.h
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+#pragma once
+
+#include <jaut_logger/jaut_logger_define.h>
+
+#include <jaut_core/define/jaut_Define.h>
+
+#include <juce_core/juce_core.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+
+
+namespace jaut
+{
+    //==================================================================================================================
+    /**
+     *  A lock-free histogram with logarithmic buckets, similar to an HDR histogram.<br>
+     *  Every power of two is split into 8 linear sub-buckets, so any recorded value will be reported with a
+     *  relative error of at most 12.5%, no matter its magnitude.
+     *  <br><br>
+     *  Recording is a handful of relaxed atomic increments, so it can be done on a hot path while another thread
+     *  reads the histogram at the same time.<br>
+     *  Do note that a read taken while values are being recorded is not an atomic snapshot, numbers may be off by
+     *  the values recorded in the meantime.
+     */
+    class JAUT_API LogHistogram
+    {
+    public:
+        /** The number of bits used to linearly divide every power of two. */
+        static constexpr int subBucketBits = 3;
+        
+        /** The number of sub-buckets in every power of two. */
+        static constexpr int numSubBuckets = (1 << subBucketBits);
+        
+        /** The total number of buckets, covering the entire range of a 64-bit value. */
+        static constexpr int numBuckets = ((64 - subBucketBits + 1) * numSubBuckets);
+        
+        //==============================================================================================================
+        LogHistogram() noexcept = default;
+        
+        //==============================================================================================================
+        /**
+         *  Adds a value to the histogram.
+         *  @param value The value to record
+         */
+        void record(std::uint64_t value) noexcept;
+        
+        /** Clears all recorded values. */
+        void reset() noexcept;
+        
+        //==============================================================================================================
+        /**
+         *  Gets the number of values that have been recorded.
+         *  @return The number of values
+         */
+        JAUT_NODISCARD
+        std::uint64_t getCount() const noexcept;
+        
+        /**
+         *  Gets the highest value that has been recorded.
+         *  @return The highest value or 0 if nothing was recorded
+         */
+        JAUT_NODISCARD
+        std::uint64_t getMax() const noexcept;
+        
+        /**
+         *  Gets the average of all recorded values.
+         *  @return The mean or 0 if nothing was recorded
+         */
+        JAUT_NODISCARD
+        double getMean() const noexcept;
+        
+        /**
+         *  Gets the value below which the given percentage of recorded values fall.<br>
+         *  The returned value is the lower bound of the bucket the percentile fell in.
+         *  
+         *  @param percentile The percentile between 0 and 100
+         *  @return The value at the percentile or 0 if nothing was recorded
+         */
+        JAUT_NODISCARD
+        std::uint64_t getValueAtPercentile(double percentile) const noexcept;
+        
+        //==============================================================================================================
+        /**
+         *  Gets the index of the bucket a value would be recorded in.
+         *  
+         *  @param value The value
+         *  @return The bucket index
+         */
+        JAUT_NODISCARD
+        static int getBucketIndex(std::uint64_t value) noexcept;
+        
+        /**
+         *  Gets the lowest value that would be recorded in the given bucket.
+         *  
+         *  @param index The bucket index
+         *  @return The lower bound of the bucket
+         */
+        JAUT_NODISCARD
+        static std::uint64_t getBucketValue(int index) noexcept;
+        
+    private:
+        using Counter = std::atomic<std::uint64_t>;
+        
+        //==============================================================================================================
+        std::array<Counter, numBuckets> buckets {};
+        
+        Counter count { 0 };
+        Counter sum   { 0 };
+        Counter max   { 0 };
+        
+        //==============================================================================================================
+        JUCE_DECLARE_NON_COPYABLE(LogHistogram)
+    };
+    
+    //==================================================================================================================
+    /**
+     *  The figures a log worker collects about its buffer.<br>
+     *  Workers will only record these if JAUT_LOGGER_METRICS is enabled, see ILogWorker::getMetrics().
+     */
+    struct JAUT_API LogWorkerMetrics
+    {
+        /** The time it took to enqueue messages, including waiting for the producer lock. (in nanoseconds) */
+        LogHistogram enqueueLatency;
+        
+        /** The number of messages that were handed to the sinks at once. */
+        LogHistogram batchSize;
+        
+        /** The highest number of messages that have been in the buffer at the same time. */
+        std::atomic<int> highWaterMark { 0 };
+        
+        /** The number of messages that could not be enqueued because the buffer was full. */
+        std::atomic<std::uint64_t> overflows { 0 };
+        
+        //==============================================================================================================
+        /**
+         *  Records an attempt to enqueue a message.
+         *  
+         *  @param latency The time the attempt took in nanoseconds
+         *  @param size    The number of messages in the buffer after the attempt or -1 if the buffer was full
+         */
+        void recordEnqueue(std::uint64_t latency, int size) noexcept;
+        
+        /**
+         *  Records an attempt to push a message onto a message buffer.<br>
+         *  Buffers report the position the message was enqueued in, which is one less than the number of messages
+         *  in the buffer after the push, this converts it before passing it on to recordEnqueue().
+         *  
+         *  @param latency  The time the attempt took in nanoseconds
+         *  @param position The position the message was enqueued in or -1 if the buffer was full
+         */
+        void recordPush(std::uint64_t latency, int position) noexcept;
+    };
+    
+    /**
+     *  The figures a log sink collects about its output.<br>
+     *  Sinks will only record these if JAUT_LOGGER_METRICS is enabled, see ILogSink::getMetrics().
+     */
+    struct JAUT_API LogSinkMetrics
+    {
+        /** The time the formatter of the sink took for a single message. (in nanoseconds) */
+        LogHistogram formatTime;
+        
+        /** The time it took to write pending output to the underlying device. (in nanoseconds) */
+        LogHistogram writeTime;
+        
+        /** The number of messages that have been printed. */
+        std::atomic<std::uint64_t> messages { 0 };
+        
+        //==============================================================================================================
+        /**
+         *  Records a message that has been formatted.
+         *  @param time The time formatting took in nanoseconds
+         */
+        void recordFormat(std::uint64_t time) noexcept;
+    };
+    
+    //==================================================================================================================
+    namespace detail
+    {
+        /** A simple stopwatch measuring nanoseconds for the logger metrics. */
+        class MetricsStopwatch
+        {
+        public:
+            /**
+             *  Gets the nanoseconds that passed since the stopwatch was created.
+             *  @return The elapsed time
+             */
+            JAUT_NODISCARD
+            std::uint64_t getElapsed() const noexcept
+            {
+                const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+                return static_cast<std::uint64_t>(elapsed.count());
+            }
+            
+        private:
+            using Clock = std::chrono::steady_clock;
+            
+            //==========================================================================================================
+            const Clock::time_point start { Clock::now() };
+        };
+        
+        /** Records the time that passed between its construction and destruction into a histogram. */
+        class ScopedMetricsTimer
+        {
+        public:
+            explicit ScopedMetricsTimer(LogHistogram &parHistogram) noexcept
+                : histogram(parHistogram)
+            {}
+            
+            ~ScopedMetricsTimer()
+            {
+                histogram.record(stopwatch.getElapsed());
+            }
+            
+        private:
+            LogHistogram     &histogram;
+            MetricsStopwatch stopwatch;
+            
+            //==========================================================================================================
+            JUCE_DECLARE_NON_COPYABLE(ScopedMetricsTimer)
+        };
+    }
+}
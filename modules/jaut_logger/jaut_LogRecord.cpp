@@ -0,0 +1,244 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogRecord.cpp
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+
+#include <jaut_logger/jaut_LogRecord.h>
+
+#include <deque>
+#include <limits>
+#include <thread>
+
+
+
+//**********************************************************************************************************************
+// region Namespace
+//======================================================================================================================
+namespace
+{
+    // The lower bits of an index select the slot, the upper bits count how often that slot was reused
+    constexpr int           slotBits     = 20;
+    constexpr std::uint32_t slotMask     = ((std::uint32_t(1) << slotBits) - 1);
+    constexpr std::uint32_t invalidIndex = std::numeric_limits<std::uint32_t>::max();
+    
+    //==================================================================================================================
+    struct ThreadTableData
+    {
+        struct Slot
+        {
+            jaut::LogThreadTable::Entry entry;
+            std::uint32_t               index;
+        };
+        
+        //==============================================================================================================
+        juce::SpinLock            lock;
+        std::deque<Slot>          slots;
+        std::deque<std::uint32_t> freeSlots;
+    };
+    
+    struct ThreadRegistration
+    {
+        std::uint32_t index;
+        
+        //==============================================================================================================
+        ThreadRegistration();
+        ~ThreadRegistration();
+    };
+    
+    //==================================================================================================================
+    JAUT_NODISCARD
+    ThreadTableData& getThreadTableData()
+    {
+        // This is leaked on purpose, threads might still exit while static objects are being destroyed
+        static ThreadTableData *data = new ThreadTableData();
+        return *data;
+    }
+    
+    JAUT_NODISCARD
+    jaut::LogThreadTable::Entry makeCurrentThreadEntry()
+    {
+        jaut::LogThreadTable::Entry entry;
+        entry.threadId = std::this_thread::get_id();
+        
+        if (const juce::Thread *c_thread = juce::Thread::getCurrentThread())
+        {
+            entry.threadName = c_thread->getThreadName();
+        }
+        
+        return entry;
+    }
+    
+    //==================================================================================================================
+    ThreadRegistration::ThreadRegistration()
+    {
+        jaut::LogThreadTable::Entry entry = makeCurrentThreadEntry();
+        
+        ThreadTableData &data = getThreadTableData();
+        const juce::SpinLock::ScopedLockType lock(data.lock);
+        
+        // The oldest free slot is reused first, which gives records of exited threads the most time to be processed
+        if (!data.freeSlots.empty())
+        {
+            const std::uint32_t slot = data.freeSlots.front();
+            data.freeSlots.pop_front();
+            
+            ThreadTableData::Slot &free_slot = data.slots[slot];
+            index = ((((free_slot.index >> slotBits) + 1) << slotBits) | slot);
+            
+            free_slot.entry = std::move(entry);
+            free_slot.index = index;
+            
+            return;
+        }
+        
+        // The last slot is never used, so that invalidIndex can't be a valid index of any generation
+        if (data.slots.size() >= slotMask)
+        {
+            // That many threads that log at the same time is hardly a thing, so we just don't keep track of the rest
+            jassertfalse;
+            index = invalidIndex;
+            return;
+        }
+        
+        index = static_cast<std::uint32_t>(data.slots.size());
+        data.slots.push_back({ std::move(entry), index });
+    }
+    
+    ThreadRegistration::~ThreadRegistration()
+    {
+        if (index == invalidIndex)
+        {
+            return;
+        }
+        
+        ThreadTableData &data = getThreadTableData();
+        const juce::SpinLock::ScopedLockType lock(data.lock);
+        
+        // The entry stays until the slot is reused, records of this thread might not have been processed yet
+        data.freeSlots.push_back(index & slotMask);
+    }
+}
+//======================================================================================================================
+// endregion Namespace
+//**********************************************************************************************************************
+// region LogThreadTable
+//======================================================================================================================
+namespace jaut
+{
+    //==================================================================================================================
+    std::uint32_t LogThreadTable::getCurrentThreadIndex()
+    {
+        static thread_local const ThreadRegistration registration;
+        return registration.index;
+    }
+    
+    const LogThreadTable::Entry& LogThreadTable::getCurrentThread()
+    {
+        static thread_local const Entry entry = makeCurrentThreadEntry();
+        return entry;
+    }
+    
+    LogThreadTable::Entry LogThreadTable::getThread(std::uint32_t parIndex)
+    {
+        ThreadTableData &data = getThreadTableData();
+        const juce::SpinLock::ScopedLockType lock(data.lock);
+        
+        if (const std::uint32_t slot = (parIndex & slotMask);
+            slot < data.slots.size() && data.slots[slot].index == parIndex)
+        {
+            return data.slots[slot].entry;
+        }
+        
+        return {};
+    }
+}
+//======================================================================================================================
+// endregion LogThreadTable
+//**********************************************************************************************************************
+// region LogRecord
+//======================================================================================================================
+namespace jaut
+{
+    //==================================================================================================================
+    LogRecord LogRecord::fromMessage(LogMessage parMessage)
+    {
+        LogRecord record;
+        record.timestamp = parMessage.timestamp.toMilliseconds();
+        record.level     = parMessage.level;
+        record.message   = std::make_shared<LogMessage>(std::move(parMessage));
+        
+        return record;
+    }
+    
+    //==================================================================================================================
+    LogMessage LogRecord::toMessage(LogSymbol parLoggerName) const
+    {
+        if (message)
+        {
+            return *message;
+        }
+        
+        const LogThreadTable::Entry thread = LogThreadTable::getThread(threadIndex);
+        
+        LogMessage log_message;
+        log_message.name       = parLoggerName;
+        log_message.timestamp  = juce::Time(timestamp);
+        log_message.level      = level;
+        log_message.threadId   = thread.threadId;
+        log_message.threadName = thread.threadName;
+        
+        if (pattern && renderer)
+        {
+            // Since this usually happens on another thread, there is nobody to report a broken pattern to,
+            // so we better make it visible in the log itself
+            try
+            {
+                log_message.message = renderer(pattern, args.data());
+            }
+            catch (const fmt::format_error &ex)
+            {
+                log_message.message << "Invalid log pattern '" << pattern << "': " << ex.what();
+            }
+        }
+        
+        return log_message;
+    }
+    
+    LogLevel::Value LogRecord::getLevel() const noexcept
+    {
+        return (message ? message->level : level);
+    }
+}
+//======================================================================================================================
+// endregion LogRecord
+//**********************************************************************************************************************
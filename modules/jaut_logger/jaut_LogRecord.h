@@ -0,0 +1,313 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogRecord.h
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+
+#pragma once
+
+#include <jaut_logger/jaut_logger_define.h>
+#include <jaut_logger/jaut_LogClock.h>
+#include <jaut_logger/jaut_LogLevel.h>
+#include <jaut_logger/jaut_LogMessage.h>
+#include <jaut_logger/jaut_LogSymbol.h>
+#include <jaut_logger/detail/jaut_fmt.h>
+
+#include <jaut_core/define/jaut_AssertDef.h>
+#include <jaut_core/define/jaut_Define.h>
+
+#include <juce_core/juce_core.h>
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+
+
+namespace jaut
+{
+    //==================================================================================================================
+    /**
+     *  Keeps track of the threads that log deferred records, so that records only need to carry a small index
+     *  instead of a copy of the thread's name.
+     *  <br><br>
+     *  A thread is registered the first time it logs a deferred record, the name of the thread will be captured at
+     *  that point. Renaming a thread after it logged for the first time will not be reflected in subsequent messages.
+     *  <br><br>
+     *  When a thread exits, its slot is released and will eventually be reused by a thread that registers later,
+     *  so the table only grows with the number of threads that are alive at the same time.<br>
+     *  Until then, records of the exited thread still resolve to its entry. Indices also count how often their
+     *  slot was reused, so a record that outlived its slot resolves to an empty entry instead of another thread.
+     *  <br><br>
+     *  Thread names are interned in the jaut::LogSymbolTable and are not released along with their thread.
+     */
+    class JAUT_API LogThreadTable
+    {
+    public:
+        /** The information stored about a single thread. */
+        struct Entry
+        {
+            /** The id of the thread. */
+            std::thread::id threadId;
+            
+            /** The name of the thread or empty if no name was set, interned in the jaut::LogSymbolTable. */
+            LogSymbol threadName;
+        };
+        
+        //==============================================================================================================
+        /**
+         *  Gets the index of the calling thread, registering it if it hasn't been registered yet.<br>
+         *  After the first call on a thread, this is just a read of a thread local variable.
+         *  
+         *  @return The index of the calling thread
+         */
+        JAUT_NODISCARD
+        static std::uint32_t getCurrentThreadIndex();
+        
+        /**
+         *  Gets the information of the calling thread.<br>
+         *  The entry is captured the first time this is called on a thread, but unlike getCurrentThreadIndex(),
+         *  this doesn't register the thread in the table.
+         *  
+         *  @return The entry of the calling thread
+         */
+        JAUT_NODISCARD
+        static const Entry& getCurrentThread();
+        
+        /**
+         *  Gets the information of the thread with the given index.
+         *  
+         *  @param index The index of the thread as returned by getCurrentThreadIndex()
+         *  @return The thread entry or an empty entry if the index is unknown or its slot was reused
+         */
+        JAUT_NODISCARD
+        static Entry getThread(std::uint32_t index);
+    };
+    
+    //==================================================================================================================
+    /**
+     *  Determines whether values of a type can be captured in a jaut::LogRecord and be formatted later on another
+     *  thread.<br>
+     *  By default this is only the case for arithmetic and enum types.
+     *  <br><br>
+     *  Anything that refers to memory it doesn't own, like std::string_view, juce::StringRef or a struct holding a
+     *  pointer, must never be deferred, since the referenced memory might be gone by the time the record is rendered.
+     *  If you have a trivially copyable type that only holds values, you can opt in by specialising this trait.
+     *  
+     *  @tparam T The type to check
+     */
+    template<class T>
+    struct JAUT_API isLogDeferrable : std::bool_constant<std::is_arithmetic_v<T> || std::is_enum_v<T>> {};
+    
+    /**
+     *  Determines whether values of a type can be captured in a jaut::LogRecord.
+     *  @tparam T The type to check
+     */
+    template<class T>
+    JAUT_API inline constexpr bool isLogDeferrable_v = isLogDeferrable<T>::value;
+
+    //==================================================================================================================
+    /**
+     *  A compact, fixed-size version of a jaut::LogMessage, that defers the expensive parts of creating a log entry
+     *  to whoever ends up processing it.
+     *  <br><br>
+     *  Instead of a formatted message, the record holds a pointer to the format string, which must outlive the record
+     *  (a string literal), and a raw copy of the format arguments.
+     *  The thread is only referenced by its index in the jaut::LogThreadTable.
+     *  This way, creating a record doesn't allocate anything at all.
+     *  <br><br>
+     *  Only arguments that are plain values can be deferred, see canDefer and jaut::isLogDeferrable.
+     *  Records can also carry an already fully built jaut::LogMessage, this is used by workers that work with records
+     *  to also accept normal messages.
+     */
+    struct JAUT_API LogRecord
+    {
+        //==============================================================================================================
+        /** The function type that renders the format string with the raw arguments of a record. */
+        using Renderer = juce::String(*)(const char *pattern, const std::byte *args);
+        
+        //==============================================================================================================
+        /** The amount of bytes a record can hold for arguments. */
+        static constexpr std::size_t argsCapacity = JAUT_LOGGER_RECORD_ARGS_SIZE;
+        
+        /**
+         *  Determines whether the given argument types can be captured in a record.<br>
+         *  This is the case if all of them are deferrable (see jaut::isLogDeferrable), trivially copyable and default
+         *  constructible, and if they fit into the argument storage together.
+         */
+        template<class ...Args>
+        static constexpr bool canDefer = ((isLogDeferrable_v<std::decay_t<Args>>
+                                           && std::is_trivially_copyable_v<std::decay_t<Args>>
+                                           && std::is_default_constructible_v<std::decay_t<Args>>) && ...)
+                                         && ((sizeof(std::decay_t<Args>) + ... + 0) <= argsCapacity);
+        
+        //==============================================================================================================
+        /**
+         *  Creates a new record from the given format string and arguments.
+         *  The calling thread will be used as the record's thread.
+         *  
+         *  @param level   The level of the record
+         *  @param pattern The format string, this must outlive the record
+         *  @param args    The arguments to format the pattern with later on
+         *  @return The new record
+         */
+        template<class ...Args>
+        JAUT_NODISCARD
+        static LogRecord create(LogLevel::Value level, const char *pattern, const Args &...args);
+        
+        /**
+         *  Creates a new record that wraps an already existing message.
+         *  
+         *  @param message The message to wrap
+         *  @return The new record
+         */
+        JAUT_NODISCARD
+        static LogRecord fromMessage(LogMessage message);
+        
+        //==============================================================================================================
+        /** The format string or nullptr if this record wraps a message. */
+        const char *pattern { nullptr };
+        
+        /** The function that knows how to read the arguments of this record. */
+        Renderer renderer { nullptr };
+        
+        /** The message if this record wraps an already built message, otherwise nullptr. */
+        std::shared_ptr<LogMessage> message;
+        
+        /** The time the record was created, in milliseconds since the epoch. */
+        std::int64_t timestamp {};
+        
+        /** The index of the thread in the jaut::LogThreadTable. */
+        std::uint32_t threadIndex {};
+        
+        /** The priority of the record. */
+        LogLevel::Value level { LogLevel::Off };
+        
+        /** The raw bytes of the format arguments. */
+        alignas(std::max_align_t) std::array<std::byte, argsCapacity> args {};
+        
+        //==============================================================================================================
+        /**
+         *  Renders this record into a full log message.<br>
+         *  This is what is supposed to happen on the thread processing the record.
+         *  
+         *  @param loggerName The name symbol of the logger this record was logged to
+         *  @return The rendered message
+         */
+        JAUT_NODISCARD
+        LogMessage toMessage(LogSymbol loggerName) const;
+        
+        /**
+         *  Gets the level of this record, or of the wrapped message.
+         *  @return The level
+         */
+        JAUT_NODISCARD
+        LogLevel::Value getLevel() const noexcept;
+    };
+    
+    //==================================================================================================================
+    namespace detail
+    {
+        template<class ...Args>
+        struct RecordArgs
+        {
+            template<std::size_t I>
+            static constexpr std::size_t offsetOf()
+            {
+                constexpr std::array<std::size_t, sizeof...(Args) + 1> sizes { sizeof(Args)..., 0 };
+                
+                std::size_t offset = 0;
+                
+                for (std::size_t i = 0; i < I; ++i)
+                {
+                    offset += sizes[i];
+                }
+                
+                return offset;
+            }
+            
+            template<class T>
+            static T read(const std::byte *data) noexcept
+            {
+                T value;
+                std::memcpy(&value, data, sizeof(T));
+                return value;
+            }
+            
+            //==========================================================================================================
+            static void write(std::byte *data, const Args &...args) noexcept
+            {
+                std::size_t offset = 0;
+                ((std::memcpy(data + offset, &args, sizeof(Args)), offset += sizeof(Args)), ...);
+            }
+            
+            static juce::String render(const char *pattern, const std::byte *data)
+            {
+                return renderImpl(pattern, data, std::index_sequence_for<Args...>{});
+            }
+            
+        private:
+            template<std::size_t ...I>
+            static juce::String renderImpl(const char                 *pattern,
+                                           JAUT_MUNUSED const std::byte *data,
+                                           std::index_sequence<I...>)
+            {
+                const std::string result = fmt::format(fmt::runtime(pattern),
+                                                       read<Args>(data + offsetOf<I>())...);
+                return juce::String::fromUTF8(result.data(), static_cast<int>(result.size()));
+            }
+        };
+    }
+    
+    //==================================================================================================================
+    // IMPLEMENTATION LogRecord
+    template<class ...Args>
+    inline LogRecord LogRecord::create(LogLevel::Value parLevel, const char *parPattern, const Args &...parArgs)
+    {
+        static_assert(canDefer<Args...>, JAUT_ASSERT_LOGGER_RECORD_CANNOT_DEFER);
+        
+        using Codec = detail::RecordArgs<std::decay_t<Args>...>;
+        
+        LogRecord record;
+        record.pattern     = parPattern;
+        record.renderer    = &Codec::render;
+        record.timestamp   = LogClock::nowMillis();
+        record.threadIndex = LogThreadTable::getCurrentThreadIndex();
+        record.level       = parLevel;
+        
+        Codec::write(record.args.data(), parArgs...);
+        return record;
+    }
+}
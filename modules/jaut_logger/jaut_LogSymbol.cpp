@@ -0,0 +1,170 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogSymbol.cpp
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+#include <jaut_logger/jaut_LogSymbol.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+
+
+
+//**********************************************************************************************************************
+// region Namespace
+//======================================================================================================================
+namespace
+{
+    using SymbolMap = std::unordered_map<juce::String, std::uint32_t, jaut::detail::StringHash>;
+    
+    //==================================================================================================================
+    struct SymbolTableData
+    {
+        using Chunk = std::array<juce::String, jaut::LogSymbolTable::chunkSize>;
+        
+        //==============================================================================================================
+        juce::SpinLock lock;
+        SymbolMap      ids;
+        
+        std::array<std::atomic<Chunk*>, jaut::LogSymbolTable::maxChunks> chunks {};
+        std::atomic<std::uint32_t> count { 1 };
+        
+        //==============================================================================================================
+        SymbolTableData()
+        {
+            // Id 0 is reserved for the empty string, which every chunk slot already is by default
+            chunks[0].store(new Chunk(), std::memory_order_release);
+            ids.emplace(juce::String(), 0);
+        }
+    };
+    
+    //==================================================================================================================
+    JAUT_NODISCARD
+    SymbolTableData& getSymbolTableData()
+    {
+        // This is leaked on purpose, loggers might still resolve symbols while static objects are being destroyed
+        static SymbolTableData *data = new SymbolTableData();
+        return *data;
+    }
+    
+    JAUT_NODISCARD
+    std::uint32_t internGlobal(const juce::String &parText)
+    {
+        SymbolTableData &data = getSymbolTableData();
+        const juce::SpinLock::ScopedLockType lock(data.lock);
+        
+        if (const auto it = data.ids.find(parText); it != data.ids.end())
+        {
+            return it->second;
+        }
+        
+        const std::uint32_t id          = data.count.load(std::memory_order_relaxed);
+        const std::uint32_t chunk_index = id / jaut::LogSymbolTable::chunkSize;
+        
+        if (chunk_index >= jaut::LogSymbolTable::maxChunks)
+        {
+            // The symbol table is meant for names, not for arbitrary text
+            throw jaut::LogSymbolException("log symbol table is full, could not intern '" + parText + "'");
+        }
+        
+        SymbolTableData::Chunk *chunk = data.chunks[chunk_index].load(std::memory_order_relaxed);
+        
+        if (!chunk)
+        {
+            chunk = new SymbolTableData::Chunk();
+            data.chunks[chunk_index].store(chunk, std::memory_order_release);
+        }
+        
+        (*chunk)[id % jaut::LogSymbolTable::chunkSize] = parText;
+        data.ids.emplace(parText, id);
+        data.count.store(id + 1, std::memory_order_release);
+        
+        return id;
+    }
+}
+//======================================================================================================================
+// endregion Namespace
+//**********************************************************************************************************************
+// region LogSymbolTable
+//======================================================================================================================
+namespace jaut
+{
+    //==================================================================================================================
+    std::uint32_t LogSymbolTable::intern(const juce::String &parText)
+    {
+        if (parText.isEmpty())
+        {
+            return 0;
+        }
+        
+        static thread_local SymbolMap cache;
+        
+        if (const auto it = cache.find(parText); it != cache.end())
+        {
+            return it->second;
+        }
+        
+        const std::uint32_t id = internGlobal(parText);
+        
+        if (cache.size() >= maxCachedSymbols)
+        {
+            cache.clear();
+        }
+        
+        cache.emplace(parText, id);
+        return id;
+    }
+    
+    const juce::String& LogSymbolTable::resolve(std::uint32_t parId) noexcept
+    {
+        SymbolTableData &data = getSymbolTableData();
+        
+        if (parId >= data.count.load(std::memory_order_acquire))
+        {
+            // Unknown ids resolve to the reserved empty string
+            parId = 0;
+        }
+        
+        const SymbolTableData::Chunk *chunk = data.chunks[parId / chunkSize].load(std::memory_order_acquire);
+        return (*chunk)[parId % chunkSize];
+    }
+    
+    std::uint32_t LogSymbolTable::getNumSymbols() noexcept
+    {
+        return getSymbolTableData().count.load(std::memory_order_acquire);
+    }
+}
+//======================================================================================================================
+// endregion LogSymbolTable
+//**********************************************************************************************************************
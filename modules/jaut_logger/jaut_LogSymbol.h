@@ -0,0 +1,195 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogSymbol.h
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+#pragma once
+
+#include <jaut_logger/exception/jaut_LogSymbolException.h>
+
+#include <jaut_core/define/jaut_Define.h>
+
+#include <juce_core/juce_core.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+
+
+namespace jaut
+{
+    //==================================================================================================================
+    namespace detail
+    {
+        /** A hash function for juce::String keys in standard containers. */
+        struct StringHash
+        {
+            JAUT_NODISCARD
+            std::size_t operator()(const juce::String &text) const noexcept
+            {
+                return static_cast<std::size_t>(text.hashCode64());
+            }
+        };
+    }
+    
+    //==================================================================================================================
+    /**
+     *  A process-wide table of interned strings, used for the recurring strings of log messages like logger, thread
+     *  and field names.<br>
+     *  Every distinct string is stored exactly once and is referred to by a small integer id, so that messages don't
+     *  need to carry their own copies.
+     *  <br><br>
+     *  Interning first checks a cache local to the calling thread, only strings the thread hasn't seen before will
+     *  take a lock.<br>
+     *  Resolving an id is lock-free and can be done from any thread.
+     *  <br><br>
+     *  Symbols are never removed, the table is meant for a bounded set of names and not for arbitrary text.
+     *  Once all ids are taken, interning a new string throws a jaut::LogSymbolException.
+     */
+    class JAUT_API LogSymbolTable
+    {
+    public:
+        /** The number of symbols allocated at once. */
+        static constexpr std::uint32_t chunkSize = 1024;
+        
+        /** The maximum number of chunks, this limits the table to about a million symbols. */
+        static constexpr std::uint32_t maxChunks = 1024;
+        
+        /**
+         *  The number of strings a thread remembers before its cache starts over.<br>
+         *  This keeps threads that see a lot of different strings from holding a copy of half the table.
+         */
+        static constexpr std::size_t maxCachedSymbols = 512;
+        
+        //==============================================================================================================
+        /**
+         *  Gets the id of the given string, adding it to the table if it wasn't interned yet.<br>
+         *  The empty string always has the id 0.
+         *  
+         *  @param text The string to intern
+         *  @return The id of the string
+         *  
+         *  @throw jaut::LogSymbolException If the string is new and the table is full
+         */
+        JAUT_NODISCARD
+        static std::uint32_t intern(const juce::String &text);
+        
+        /**
+         *  Gets the string of the given id.
+         *  
+         *  @param id The id as returned by intern()
+         *  @return The string or an empty string if the id is unknown
+         */
+        JAUT_NODISCARD
+        static const juce::String& resolve(std::uint32_t id) noexcept;
+        
+        /**
+         *  Gets the number of symbols in the table, including the empty string.
+         *  @return The number of symbols
+         */
+        JAUT_NODISCARD
+        static std::uint32_t getNumSymbols() noexcept;
+    };
+    
+    //==================================================================================================================
+    /**
+     *  A handle to a string interned in the jaut::LogSymbolTable.<br>
+     *  Copying a symbol is copying an integer, the string will only be looked up when it is actually needed, which
+     *  usually is when a formatter renders the message.
+     */
+    class JAUT_API LogSymbol
+    {
+    public:
+        /** Creates an empty symbol. */
+        LogSymbol() noexcept = default;
+        
+        /**
+         *  Creates a symbol for the given string, interning it if necessary.
+         *  
+         *  @param text The string
+         *  @throw jaut::LogSymbolException If the string is new and the symbol table is full
+         */
+        LogSymbol(const juce::String &text) // NOLINT
+            : id(LogSymbolTable::intern(text))
+        {}
+        
+        /**
+         *  Creates a symbol for the given string, interning it if necessary.
+         *  
+         *  @param text The string
+         *  @throw jaut::LogSymbolException If the string is new and the symbol table is full
+         */
+        LogSymbol(const char *text) // NOLINT
+            : LogSymbol(juce::String(text))
+        {}
+        
+        //==============================================================================================================
+        JAUT_NODISCARD
+        bool operator==(const LogSymbol &other) const noexcept { return (id == other.id); }
+        
+        JAUT_NODISCARD
+        bool operator!=(const LogSymbol &other) const noexcept { return (id != other.id); }
+        
+        //==============================================================================================================
+        /**
+         *  Gets the string this symbol refers to.
+         *  @return The string
+         */
+        JAUT_NODISCARD
+        const juce::String& toString() const noexcept { return LogSymbolTable::resolve(id); }
+        
+        /**
+         *  Gets the id of the symbol in the jaut::LogSymbolTable.
+         *  @return The id
+         */
+        JAUT_NODISCARD
+        std::uint32_t getId() const noexcept { return id; }
+        
+        /**
+         *  Whether this symbol refers to the empty string.
+         *  @return True if the string is empty
+         */
+        JAUT_NODISCARD
+        bool isEmpty() const noexcept { return (id == 0); }
+        
+        /**
+         *  Whether this symbol refers to a non-empty string.
+         *  @return True if the string is not empty
+         */
+        JAUT_NODISCARD
+        bool isNotEmpty() const noexcept { return (id != 0); }
+        
+    private:
+        std::uint32_t id { 0 };
+    };
+}
@@ -0,0 +1,152 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_OverflowPolicy.h
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+#pragma once
+
+#include <jaut_logger/jaut_LogLevel.h>
+
+#include <jaut_core/define/jaut_Define.h>
+
+#include <cstdint>
+
+
+
+namespace jaut
+{
+    /** Determines what a logger should do with a message when the buffer of its worker is full. */
+    struct JAUT_API OverflowPolicy
+    {
+        //==============================================================================================================
+        enum Value
+        {
+            /**
+             *  Retries to enqueue the message as described by BasicLogger::Options::bufferOverflowRetryTimeout.
+             *  <br><br>
+             *  This is the old behaviour and busy-spins while retrying, prefer one of the other policies if the
+             *  logger is expected to overflow regularly.
+             */
+            Retry,
+            
+            /** Discards the message that could not be enqueued. */
+            DropNewest,
+            
+            /**
+             *  Discards the oldest message in the buffer to make room for the new one.
+             *  <br><br>
+             *  This is only possible if the worker can consume from the producer site, see
+             *  ILogWorker::enqueueReplacingOldest().<br>
+             *  Workers that can't will discard the new message instead, like DropNewest.
+             */
+            DropOldest,
+            
+            /**
+             *  Blocks the logging thread until the message could be enqueued.<br>
+             *  Instead of spinning, the thread requests a flush and then sleeps with an exponentially growing
+             *  interval, up to Settings::maxBackoff.
+             */
+            Block,
+            
+            /**
+             *  Discards messages below Settings::protectedLevel at random and blocks for the rest.<br>
+             *  Only a fraction of Settings::sampleRate of these messages will be kept, messages of the protected level
+             *  or above are never discarded.
+             */
+            Sample
+        };
+        
+        //==============================================================================================================
+        /** A struct of data that describes the overflow behaviour for a jaut::BasicLogger. */
+        struct Settings
+        {
+            /**
+             *  The policy to apply when the buffer is full.
+             *  @see jaut::OverflowPolicy
+             */
+            Value policy = Retry;
+            
+            /**
+             *  The lowest level that will never be discarded by the Sample policy.
+             *  Messages of this level or above will always block until they could be enqueued.
+             */
+            LogLevel::Value protectedLevel = LogLevel::Error;
+            
+            /**
+             *  The fraction of messages below the protected level that should be kept by the Sample policy.<br>
+             *  This should be a value between 0 and 1.
+             */
+            double sampleRate = 0.1;
+            
+            /** The longest time a blocked thread sleeps before trying again. (in microseconds) */
+            int maxBackoff = 1000;
+            
+            /**
+             *  The amount of milliseconds a blocked thread waits for room in the buffer before it discards the
+             *  message.<br>
+             *  If this is -1, it will block until it could enqueue the message.
+             */
+            int blockTimeout = -1;
+        };
+        
+        //==============================================================================================================
+        /** The counters of a logger for messages that were affected by its overflow policy. */
+        struct Statistics
+        {
+            /** The number of messages that were discarded because the buffer was full. */
+            std::uint64_t droppedNewest { 0 };
+            
+            /** The number of buffered messages that were discarded to make room for a new one. */
+            std::uint64_t droppedOldest { 0 };
+            
+            /** The number of messages that were discarded by the Sample policy. */
+            std::uint64_t sampledOut { 0 };
+            
+            /** The number of messages that were discarded because they were blocked for too long. */
+            std::uint64_t timedOut { 0 };
+            
+            /** The number of times a logging thread had to block because the buffer was full. */
+            std::uint64_t blocked { 0 };
+            
+            //==========================================================================================================
+            /**
+             *  Gets the number of all messages that were lost due to overflowing.
+             *  @return The number of lost messages
+             */
+            JAUT_NODISCARD
+            std::uint64_t getTotalDropped() const noexcept
+            {
+                return droppedNewest + droppedOldest + sampledOut + timedOut;
+            }
+        };
+    };
+}
@@ -38,11 +38,16 @@
 
 // Main
 #include <jaut_logger/jaut_AbstractLogger.cpp>
+#include <jaut_logger/jaut_LogClock.cpp>
+#include <jaut_logger/jaut_LogMetrics.cpp>
+#include <jaut_logger/jaut_LogRecord.cpp>
+#include <jaut_logger/jaut_LogSymbol.cpp>
 
 // Builder
 #include "jaut_logger/builder/factory/jaut_FactoryNode.cpp"
 
 // Formatters
+#include <jaut_logger/format/jaut_LogFormatBinary.cpp>
 #include <jaut_logger/format/jaut_LogFormatCallback.cpp>
 #include <jaut_logger/format/jaut_LogFormatJson.cpp>
 #include <jaut_logger/format/jaut_LogFormatPattern.cpp>
@@ -59,4 +64,9 @@
 
 // Sinks
 #include <jaut_logger/sink/jaut_LogSinkFile.cpp>
+#include <jaut_logger/sink/jaut_LogSinkMapped.cpp>
+#include <jaut_logger/sink/jaut_LogSinkPosixFile.cpp>
 #include <jaut_logger/sink/jaut_LogSinkRotatingFile.cpp>
+
+// Workers
+#include <jaut_logger/worker/jaut_LogWorkerThreaded.cpp>
@@ -59,9 +59,14 @@
 // Main
 #include <jaut_logger/jaut_AbstractLogger.h>
 #include <jaut_logger/jaut_BasicLogger.h>
+#include <jaut_logger/jaut_LogClock.h>
 #include <jaut_logger/jaut_FlushPolicy.h>
+#include <jaut_logger/jaut_OverflowPolicy.h>
 #include <jaut_logger/jaut_LogLevel.h>
 #include <jaut_logger/jaut_LogMessage.h>
+#include <jaut_logger/jaut_LogMetrics.h>
+#include <jaut_logger/jaut_LogRecord.h>
+#include <jaut_logger/jaut_LogSymbol.h>
 
 // Detail
 #include <jaut_logger/detail/jaut_fmt.h>
@@ -69,9 +74,11 @@
 // Exceptions
 #include <jaut_logger/exception/jaut_LogIOException.h>
 #include <jaut_logger/exception/jaut_LogRotationException.h>
+#include <jaut_logger/exception/jaut_LogSymbolException.h>
 
 // Formatters
 #include <jaut_logger/format/jaut_ILogFormat.h>
+#include <jaut_logger/format/jaut_LogFormatBinary.h>
 #include <jaut_logger/format/jaut_LogFormatCallback.h>
 #include <jaut_logger/format/jaut_LogFormatJson.h>
 #include <jaut_logger/format/jaut_LogFormatPattern.h>
@@ -92,5 +99,17 @@
 // Sinks
 #include <jaut_logger/sink/jaut_ILogSink.h>
 #include <jaut_logger/sink/jaut_LogSinkFile.h>
+#include <jaut_logger/sink/jaut_LogSinkMapped.h>
 #include <jaut_logger/sink/jaut_LogSinkOstream.h>
+#include <jaut_logger/sink/jaut_LogSinkPosixFile.h>
 #include <jaut_logger/sink/jaut_LogSinkRotatingFile.h>
+
+// Workers
+#include <jaut_logger/worker/jaut_ILogWorker.h>
+#include <jaut_logger/worker/jaut_LogRunMerger.h>
+#include <jaut_logger/worker/jaut_LogWorkerAsync.h>
+#include <jaut_logger/worker/jaut_LogWorkerDeferred.h>
+#include <jaut_logger/worker/jaut_LogWorkerParallel.h>
+#include <jaut_logger/worker/jaut_LogWorkerSimple.h>
+#include <jaut_logger/worker/jaut_LogWorkerThreadLocal.h>
+#include <jaut_logger/worker/jaut_LogWorkerThreaded.h>
@@ -46,10 +46,59 @@
 
 /** Config: JAUT_LOGGER_ASYNC_SLEEP
     
-    Specifies the sleep amount in milliseconds the async logging worker-thread will sleep for.
-    Unless you know what you are doing, you shouldn't touch this.
-    A value of -1 will disable the thread timeout and a value of 0 will yield the thread.
+    Specifies the maximum amount of milliseconds the async logging worker-thread will wait for a flush request,
+    before it wakes up on its own to re-evaluate its flush policies.
+    The worker-thread is notified whenever a flush is requested and will wake up for timed flushes on its own,
+    so unless you know what you are doing, you shouldn't touch this.
+    A value of -1 will let the thread wait until it is notified and a value of 0 will turn it into a polling thread.
  */
 #ifndef JAUT_LOGGER_ASYNC_SLEEP
-    #define JAUT_LOGGER_ASYNC_SLEEP 100
+    #define JAUT_LOGGER_ASYNC_SLEEP -1
+#endif
+
+/** Config: JAUT_LOGGER_RECORD_ARGS_SIZE
+    
+    Specifies the amount of bytes a jaut::LogRecord reserves for the arguments of a deferred log call.
+    Deferred calls whose arguments don't fit will be formatted right away instead.
+    Every slot of a record buffer will be this big, so keep it reasonably small.
+ */
+#ifndef JAUT_LOGGER_RECORD_ARGS_SIZE
+    #define JAUT_LOGGER_RECORD_ARGS_SIZE 64
+#endif
+
+/** Config: JAUT_LOGGER_MIN_LEVEL
+    
+    Specifies the lowest jaut::LogLevel, by its name, that the JAUT_LOG_<LEVEL> macros will compile in.
+    Macro calls of any level below that will be removed entirely, including the evaluation of their arguments,
+    regardless of what level the logger has been set to at runtime.
+    For example, setting this to Info for release builds will strip all trace, debug and verbose calls.
+ */
+#ifndef JAUT_LOGGER_MIN_LEVEL
+    #define JAUT_LOGGER_MIN_LEVEL Trace
+#endif
+
+/** Config: JAUT_LOGGER_METRICS
+    
+    Enables the collection of metrics by the inbuilt workers and sinks, see jaut::ILogWorker::getMetrics() and
+    jaut::ILogSink::getMetrics().
+    This adds a few clock reads and relaxed atomic increments to every message, which is why it is off by default.
+ */
+#ifndef JAUT_LOGGER_METRICS
+    #define JAUT_LOGGER_METRICS 0
+#endif
+
+/** Config: JAUT_OPTLIB_ZSTD
+    
+    Enables zstd compressed log archives (".zst") for jaut::StrategyPattern.
+    zstd is a lot faster than gzip at similar compression ratios, which makes it the better fit for short rotation
+    intervals or big logs.
+    This requires the zstd library to be available and linked against, which is why it needs to be turned on
+    explicitly.
+ */
+#ifndef JAUT_OPTLIB_ZSTD
+    #define JAUT_OPTLIB_ZSTD 0
+#endif
+
+#if JAUT_OPTLIB_ZSTD && !__has_include(<zstd.h>)
+    #error "JAUT_OPTLIB_ZSTD is enabled, but zstd could not be found"
 #endif
@@ -34,6 +34,10 @@
 
 #include <jaut_logger/rotation/jaut_LogRotationManager.h>
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
 
 
 //**********************************************************************************************************************
@@ -44,6 +48,92 @@ namespace
 //======================================================================================================================
 // endregion Namespace
 //**********************************************************************************************************************
+// region RotationThread
+//======================================================================================================================
+namespace jaut
+{
+    class LogRotationManager::RotationThread : public juce::Thread
+    {
+    public:
+        RotationThread(LogRotationManager &parManager, int parCapacity)
+            : juce::Thread("Log Rotation"),
+              manager (parManager),
+              capacity(static_cast<std::size_t>(std::max(parCapacity, 1)))
+        {
+            startThread();
+        }
+        
+        ~RotationThread() override
+        {
+            {
+                jdscoped std::lock_guard(mutex);
+                shouldStop = true;
+            }
+            
+            condition.notify_all();
+            
+            // Pending rotations are still archived before the thread exits,
+            // so we don't want to give up on it after a timeout
+            (void) stopThread(-1);
+        }
+        
+        //==============================================================================================================
+        void enqueue(juce::File parSource)
+        {
+            std::unique_lock lock(mutex);
+            condition.wait(lock, [this]() { return (queue.size() < capacity); });
+            
+            queue.emplace_back(std::move(parSource));
+            lock.unlock();
+            
+            condition.notify_all();
+        }
+        
+    private:
+        LogRotationManager &manager;
+        
+        std::deque<juce::File>  queue;
+        std::mutex              mutex;
+        std::condition_variable condition;
+        std::size_t             capacity;
+        bool                    shouldStop { false };
+        
+        //==============================================================================================================
+        void run() override
+        {
+            for (;;)
+            {
+                juce::File source;
+                
+                {
+                    std::unique_lock lock(mutex);
+                    condition.wait(lock, [this]() { return (shouldStop || !queue.empty()); });
+                    
+                    if (queue.empty())
+                    {
+                        return;
+                    }
+                    
+                    source = queue.front();
+                }
+                
+                manager.archive(source);
+                
+                {
+                    // The entry is only removed after it has been archived,
+                    // so that the capacity also covers the rotation in progress
+                    jdscoped std::lock_guard(mutex);
+                    queue.pop_front();
+                }
+                
+                condition.notify_all();
+            }
+        }
+    };
+}
+//======================================================================================================================
+// endregion RotationThread
+//**********************************************************************************************************************
 // region LogRotationManager
 //======================================================================================================================
 namespace jaut
@@ -51,10 +141,32 @@ namespace jaut
     LogRotationManager::LogRotationManager(juce::File                parLogFile,
                                            NonNull<RotationPolicy>   parRotationPolicy,
                                            NonNull<RotationStrategy> parRotationStrategy)
+        : LogRotationManager(std::move(parLogFile), std::move(parRotationPolicy), std::move(parRotationStrategy), {})
+    {}
+    
+    LogRotationManager::LogRotationManager(juce::File                parLogFile,
+                                           NonNull<RotationPolicy>   parRotationPolicy,
+                                           NonNull<RotationStrategy> parRotationStrategy,
+                                           Options                   parOptions)
         : policy  (std::move(parRotationPolicy.get())),
           strategy(std::move(parRotationStrategy.get())),
+          options (parOptions),
           logFile (std::move(parLogFile))
-    {}
+    {
+        jassert(options.maxPendingRotations > 0);
+        
+        refreshLogSize();
+        
+        if (options.async)
+        {
+            rotationThread = std::make_unique<RotationThread>(*this, options.maxPendingRotations);
+        }
+    }
+    
+    LogRotationManager::~LogRotationManager()
+    {
+        rotationThread.reset();
+    }
     
     //==================================================================================================================
     const RotationPolicy& LogRotationManager::getPolicy() const noexcept
@@ -72,10 +184,20 @@ namespace jaut
         return logFile;
     }
     
+    const juce::File& LogRotationManager::getRotationSource() const noexcept
+    {
+        return rotationSource;
+    }
+    
+    const LogRotationManager::Options& LogRotationManager::getOptions() const noexcept
+    {
+        return options;
+    }
+    
     //==================================================================================================================
-    bool LogRotationManager::tryRotateLogs(const LogMessage &parLogMessage, const juce::String &parMessageRendered)
+    bool LogRotationManager::tryRotateLogs(const LogMessage &parLogMessage, std::size_t parMessageSize)
     {
-        if (!logFile.exists())
+        if (!logExists)
         {
             return false;
         }
@@ -83,7 +205,8 @@ namespace jaut
         const RotationPolicyArgs args {
             logFile,
             parLogMessage,
-            parMessageRendered
+            logSize,
+            parMessageSize
         };
         
         if (policy(args))
@@ -95,18 +218,98 @@ namespace jaut
         return false;
     }
     
+    bool LogRotationManager::tryRotateLogs(const LogMessage &parLogMessage, const juce::String &parMessageRendered)
+    {
+        return tryRotateLogs(parLogMessage, parMessageRendered.getNumBytesAsUTF8());
+    }
+    
     void LogRotationManager::forceRotateLogs()
     {
         if (!logFile.exists())
         {
+            logExists = false;
             return;
         }
         
         eventBeforeRotation.invoke(logFile);
         
+        if (rotationThread)
+        {
+            rotationThread->enqueue(stageLogFile());
+            logExists = logFile.create().wasOk();
+            logSize   = 0;
+            
+            eventLogRenewed.invoke(logFile);
+            return;
+        }
+        
+        rotationSource = logFile;
+        
         const juce::File rotated_file = strategy(*this);
         (void) logFile.deleteFile();
-        (void) logFile.create();
+        
+        logExists = logFile.create().wasOk();
+        logSize   = 0;
+        
+        eventLogRenewed.invoke(logFile);
+        eventAfterRotation.invoke(rotated_file);
+    }
+    
+    //==================================================================================================================
+    void LogRotationManager::reportWritten(std::uint64_t parNumBytes) noexcept
+    {
+        logSize += parNumBytes;
+    }
+    
+    void LogRotationManager::reportLogSize(std::uint64_t parSize) noexcept
+    {
+        logSize = parSize;
+    }
+    
+    void LogRotationManager::refreshLogSize()
+    {
+        logExists = logFile.existsAsFile();
+        logSize   = (logExists ? static_cast<std::uint64_t>(logFile.getSize()) : 0);
+    }
+    
+    std::uint64_t LogRotationManager::getLogSize() const noexcept
+    {
+        return logSize;
+    }
+    
+    //==================================================================================================================
+    juce::File LogRotationManager::stageLogFile()
+    {
+        // Renaming is atomic on the same volume, so no matter how big the log is,
+        // this is the only file operation the logging thread has to wait for
+        const juce::File staged = logFile.getSiblingFile(logFile.getFileName() + ".rotating")
+                                         .getNonexistentSibling(false);
+        
+        if (!logFile.moveFileTo(staged))
+        {
+            throw LogRotationException("could not stage log '" + logFile.getFullPathName() + "' for rotation");
+        }
+        
+        return staged;
+    }
+    
+    void LogRotationManager::archive(const juce::File &parSource)
+    {
+        juce::File rotated_file;
+        
+        try
+        {
+            rotationSource = parSource;
+            rotated_file   = strategy(*this);
+            
+            (void) parSource.deleteFile();
+        }
+        catch (const std::exception&)
+        {
+            // There is no one to rethrow this to on the rotation thread,
+            // so we keep the staged log around to not lose any of its events
+            rotated_file = juce::File();
+        }
         
         eventAfterRotation.invoke(rotated_file);
     }
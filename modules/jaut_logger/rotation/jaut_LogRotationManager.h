@@ -82,12 +82,42 @@ namespace jaut
      *      // return newArchive
      *  }
      *  @endcode
+     *  
+     *  If Options::async is enabled, the manager will only rename the log file on the thread that triggered the
+     *  rotation and create a new empty log file in its place.<br>
+     *  The rotation strategy will then be run on a background thread with the renamed file as its source,
+     *  so that compressing and shifting archives don't stall logging.
      */
     class JAUT_API LogRotationManager
     {
     public:
         using BeforeRotationHandler = EventHandler<const juce::File&>;
         using AfterRotationHandler  = BeforeRotationHandler;
+        using LogRenewedHandler     = BeforeRotationHandler;
+        
+        //==============================================================================================================
+        static constexpr bool default_async               = false;
+        static constexpr int  default_maxPendingRotations = 4;
+        
+        //==============================================================================================================
+        struct Options
+        {
+            /**
+             *  Whether the rotation strategy should be run on a background thread.<br>
+             *  If this is true, the log file will only be renamed on the thread that triggered the rotation,
+             *  everything else, like compressing or shifting archives, will be done by the rotation thread.
+             *  <br><br>
+             *  Note that in this case eventAfterRotation will be raised on the rotation thread.
+             */
+            bool async = default_async;
+            
+            /**
+             *  If async is enabled, the maximum number of renamed log files that may wait to be archived.<br>
+             *  When this limit is reached, the next rotation will block until the rotation thread has caught up.
+             *  (can not be less than 1)
+             */
+            int maxPendingRotations = default_maxPendingRotations;
+        };
         
         //==============================================================================================================
         /**
@@ -99,12 +129,24 @@ namespace jaut
         Event<BeforeRotationHandler> eventBeforeRotation;
         
         /**
-         *  This event will be raised after the rotation happened.
-         *  This is useful for opening the new log file.
+         *  This event will be raised after the rotation happened and the archive has been created.
+         *  <br><br>
+         *  If Options::async is enabled, this will be raised on the rotation thread once archiving completed.<br>
+         *  Should archiving fail on the rotation thread, the renamed log file will be kept and the parameter
+         *  will be an invalid file.
          *
          *  @param par1 The rotated log file or invalid file if it was deleted
          */
-        Event<AfterRotationHandler> eventAfterRotation;
+        Event<AfterRotationHandler, juce::CriticalSection> eventAfterRotation;
+        
+        /**
+         *  This event will be raised once a new empty log file has replaced the rotated one.<br>
+         *  This is always raised on the thread that triggered the rotation, so this is where you'd want to
+         *  open the new log file.
+         *
+         *  @param par1 The new log file
+         */
+        Event<LogRenewedHandler> eventLogRenewed;
         
         //==============================================================================================================
         /**
@@ -120,6 +162,23 @@ namespace jaut
                            NonNull<RotationPolicy>   rotationPolicy,
                            NonNull<RotationStrategy> rotationStrategy);
         
+        /**
+         *  Creates a new instance of the LogRotationManager class.
+         *
+         *  @param logFile          The log file to manage, the extension of this file will also determine the
+         *                          to-be-used log extension for the manager
+         *  @param rotationPolicy   The invocable that determines WHEN logs should be rotated
+         *  @param rotationStrategy The invocable that determines HOW logs should be rotated
+         *  @param options          The options of the rotation manager
+         */
+        LogRotationManager(juce::File                logFile,
+                           NonNull<RotationPolicy>   rotationPolicy,
+                           NonNull<RotationStrategy> rotationStrategy,
+                           Options                   options);
+        
+        /** Waits for all pending rotations to be archived, if Options::async is enabled. */
+        ~LogRotationManager();
+        
         //==============================================================================================================
         /**
          *  Gets the rotation policy.
@@ -142,10 +201,42 @@ namespace jaut
         JAUT_NODISCARD
         const juce::File& getLogFile() const noexcept;
         
+        /**
+         *  Gets the file the rotation strategy should archive.<br>
+         *  This is the log file itself, or if Options::async is enabled, the renamed log file that is currently being
+         *  archived by the rotation thread.
+         *  <br><br>
+         *  This is only meaningful while the rotation strategy is running.
+         *  
+         *  @return The file to be archived
+         */
+        JAUT_NODISCARD
+        const juce::File& getRotationSource() const noexcept;
+        
+        /**
+         *  Gets the options of this rotation manager.
+         *  @return The options
+         */
+        JAUT_NODISCARD
+        const Options& getOptions() const noexcept;
+        
         //==============================================================================================================
         /**
          *  Tries to rotate the log file if the current rotation policy evaluates to true, otherwise does nothing.
          *  If you want to force a rotation, you can use forceRotateLogs() instead.
+         *  <br><br>
+         *  This doesn't touch the file system, unless the log is actually rotated.
+         *
+         *  @param logMessage  The message that should get logged
+         *  @param messageSize The number of bytes the rendered message will add to the log
+         *  
+         *  @return True if the log was successfully rotated, false if not
+         */
+        bool tryRotateLogs(const LogMessage &logMessage, std::size_t messageSize);
+        
+        /**
+         *  Tries to rotate the log file if the current rotation policy evaluates to true, otherwise does nothing.
+         *  This is the same as the other overload, but it takes the size from the given rendered message.
          *
          *  @param logMessage      The message that should get logged
          *  @param messageRendered The rendered message that was created from the formatter
@@ -159,14 +250,56 @@ namespace jaut
          *  <br><br>
          *  This will rotate the log, delete and create a new empty file,
          *  so it would make sense to first close the stream whichever handles the file and open it afterwards.<br>
-         *  You can do so by subscribing to the events eventBeforeRotation and eventAfterRotation.
+         *  You can do so by subscribing to the events eventBeforeRotation and eventLogRenewed.
          */
         void forceRotateLogs();
         
+        //==============================================================================================================
+        /**
+         *  Reports the number of bytes the sink has written to the log file.<br>
+         *  The manager keeps track of the size of the log in memory, so that rotation policies don't need to ask
+         *  the file system for it with every message.
+         *  
+         *  @param numBytes The number of bytes that were written
+         */
+        void reportWritten(std::uint64_t numBytes) noexcept;
+        
+        /**
+         *  Sets the size of the log file, for sinks that know the exact size, for example after truncating it.
+         *  @param size The size of the log file in bytes
+         */
+        void reportLogSize(std::uint64_t size) noexcept;
+        
+        /**
+         *  Reads the size of the log file from the file system.<br>
+         *  This should be called whenever the log file was opened by something else than this manager.
+         */
+        void refreshLogSize();
+        
+        /**
+         *  Gets the size of the log file as tracked by this manager.
+         *  @return The size of the log file in bytes
+         */
+        JAUT_NODISCARD
+        std::uint64_t getLogSize() const noexcept;
+        
     private:
+        class RotationThread;
+        
+        //==============================================================================================================
         RotationPolicy   policy;
         RotationStrategy strategy;
+        Options          options;
         juce::File       logFile;
+        juce::File       rotationSource;
+        std::uint64_t    logSize   { 0 };
+        bool             logExists { false };
+        
+        std::unique_ptr<RotationThread> rotationThread;
+        
+        //==============================================================================================================
+        juce::File stageLogFile();
+        void       archive(const juce::File &source);
         
         //==============================================================================================================
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LogRotationManager)
@@ -50,23 +50,12 @@ namespace jaut
     {}
     
     //==================================================================================================================
-    bool PolicySizeLimit::operator()(const RotationPolicyArgs &parRotationArgs)
+    bool PolicySizeLimit::operator()(const RotationPolicyArgs &parRotationArgs) const noexcept
     {
-        if (fileSize == 0)
-        {
-            fileSize = parRotationArgs.currentLogFile.getSize();
-        }
+        const std::uint64_t file_size = parRotationArgs.currentLogSize;
+        const std::uint64_t new_size  = (file_size + parRotationArgs.messageSize);
         
-        const std::size_t new_size = (fileSize + parRotationArgs.messageRendered.getNumBytesAsUTF8());
-        
-        if ((uponReaching ? (new_size >= maxSize) : (fileSize >= maxSize)))
-        {
-            fileSize = 0;
-            return true;
-        }
-        
-        fileSize = new_size;
-        return false;
+        return (uponReaching ? (new_size >= maxSize) : (file_size >= maxSize));
     }
 }
 //======================================================================================================================
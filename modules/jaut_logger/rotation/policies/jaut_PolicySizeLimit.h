@@ -61,14 +61,13 @@ namespace jaut
         explicit PolicySizeLimit(std::size_t maxSizeInBytes, bool uponReaching = default_uponReaching);
         
         //==============================================================================================================
-        bool operator()(const RotationPolicyArgs &rotationArgs);
+        bool operator()(const RotationPolicyArgs &rotationArgs) const noexcept;
         
     private:
         inline static const std::size_t newLineSize = juce::String(juce::NewLine::getDefault()).getNumBytesAsUTF8();
         
         //==============================================================================================================
         std::size_t maxSize;
-        std::size_t fileSize { 0 };
         bool        uponReaching;
         
         //==============================================================================================================
@@ -48,7 +48,8 @@ namespace jaut
     {
         /**
          *  The current file that is being logged to and has not yet been rotated.<br>
-         *  This is where you'd want to check whether a rotation might be necessary.
+         *  Do note that this is evaluated for every message, so you should avoid querying the file system here,
+         *  for the size of the file use currentLogSize instead.
          */
         const juce::File &currentLogFile;
         
@@ -59,11 +60,18 @@ namespace jaut
         const LogMessage &message;
         
         /**
-         *  The rendered message from the last log event.<br>
-         *  This will be your RotationArgs::message but already fed through the formatter that was used,
+         *  The size of the current log file in bytes.<br>
+         *  This is tracked in memory by the jaut::LogRotationManager from what the sink reported to have written,
+         *  so it doesn't cost a call to the file system.
+         */
+        std::uint64_t currentLogSize;
+        
+        /**
+         *  The number of bytes the last log event will add to the log file.<br>
+         *  This is the size of RotationArgs::message after it was fed through the formatter that was used,
          *  this is what you'd usually base your rotation on.
          */
-        const juce::String &messageRendered;
+        std::size_t messageSize;
     };
     
     //==================================================================================================================
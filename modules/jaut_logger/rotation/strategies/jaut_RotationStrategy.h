@@ -54,6 +54,9 @@ namespace jaut
      *  <br><br>
      *  If this is used in conjunction with jaut::SinkRotatingFile,
      *  you do not need to take care of closing/deleting the main log file.
+     *  <br><br>
+     *  The file to archive should be obtained from LogRotationManager::getRotationSource(),
+     *  as with asynchronous rotation this will be the renamed log file and not the live one.
      *  
      *  @param currentLogFile The log rotation manager that this callback is tied to
      *  @return The newly rotated archive file
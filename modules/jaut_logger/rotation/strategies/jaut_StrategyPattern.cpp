@@ -39,6 +39,10 @@
 #include <jaut_logger/exception/jaut_LogIOException.h>
 #include <jaut_logger/rotation/jaut_LogRotationManager.h>
 
+#if JAUT_OPTLIB_ZSTD
+    #include <zstd.h>
+#endif
+
 
 
 //**********************************************************************************************************************
@@ -46,49 +50,344 @@
 //======================================================================================================================
 namespace
 {
-    bool copyTo(const juce::File &src, const juce::File &dest, int compressionLevel)
+    //==================================================================================================================
+    using Options = jaut::StrategyPattern::Options;
+    
+    //==================================================================================================================
+    constexpr std::array<juce::uint32, 256> crcTable = []()
     {
-        const juce::String path = dest.getFileName();
+        std::array<juce::uint32, 256> table {};
         
-        if (const juce::File parent = dest.getParentDirectory();
-            !parent.exists())
+        for (juce::uint32 i = 0; i < 256; ++i)
         {
-            if (parent.createDirectory().failed())
+            juce::uint32 crc = i;
+            
+            for (int j = 0; j < 8; ++j)
             {
-                throw jaut::LogIOException("could not create log archive parent structure");
+                crc = ((crc & 1u) ? (0xedb88320u ^ (crc >> 1)) : (crc >> 1));
             }
+            
+            table[i] = crc;
         }
         
-        if (path.endsWith(".zip"))
+        return table;
+    }();
+    
+    juce::uint32 updateCrc(juce::uint32 crc, const char *data, std::size_t size) noexcept
+    {
+        crc = ~crc;
+        
+        for (std::size_t i = 0; i < size; ++i)
         {
-            juce::ZipFile::Builder builder;
-            builder.addFile(src, compressionLevel);
+            crc = crcTable[(crc ^ static_cast<juce::uint8>(data[i])) & 0xffu] ^ (crc >> 8);
+        }
+        
+        return ~crc;
+    }
+    
+    //==================================================================================================================
+    /** Reads the source in chunks of Options::chunkSize, so that not more than that is ever in memory. */
+    template<class Fn>
+    bool pumpStream(juce::InputStream &input, int chunkSize, Fn &&consumer)
+    {
+        juce::HeapBlock<char> chunk(static_cast<std::size_t>(chunkSize));
+        
+        while (!input.isExhausted())
+        {
+            const int num_read = input.read(chunk.get(), chunkSize);
             
-            juce::FileOutputStream fos(dest);
+            if (num_read < 0)
+            {
+                return false;
+            }
+            
+            if (num_read == 0)
+            {
+                break;
+            }
             
-            if (!builder.writeToStream(fos, nullptr))
+            if (!consumer(chunk.get(), static_cast<std::size_t>(num_read)))
             {
                 return false;
             }
         }
-        else if (path.endsWith(".gz"))
+        
+        return true;
+    }
+    
+    //==================================================================================================================
+    bool writeGzip(juce::FileInputStream &input, juce::FileOutputStream &output, const Options &options)
+    {
+        juce::GZIPCompressorOutputStream gzos(output, options.compressionLevel,
+                                              juce::GZIPCompressorOutputStream::windowBitsGZIP);
+        
+        const bool result = pumpStream(input, options.chunkSize, [&gzos](const char *data, std::size_t size)
+        {
+            return gzos.write(data, size);
+        });
+        
+        gzos.flush();
+        return result;
+    }
+    
+    /**
+     *  The log size from which on zip archives are written in the zip64 format.<br>
+     *  Deflate can slightly outgrow incompressible data, so this leaves it some headroom below 4 GB.
+     */
+    constexpr juce::int64 zip64Threshold = static_cast<juce::int64>(0xffffffffu - (0xffffffffu / 64));
+    
+    /**
+     *  Writes a single entry zip archive while compressing, unlike juce::ZipFile::Builder, which keeps the entire
+     *  compressed entry in memory before writing it.<br>
+     *  Since sizes and checksum are only known after compressing, they are written to a data descriptor after the
+     *  entry, and archives with a log of at least zip64MinSize bytes are written in the zip64 format.
+     */
+    bool writeZip(juce::FileInputStream &input, juce::FileOutputStream &output, const juce::String &entryName,
+                  const juce::Time &modificationTime, const Options &options,
+                  juce::int64 zip64MinSize = zip64Threshold)
+    {
+        const bool zip64 = (input.getTotalLength() >= zip64MinSize);
+        
+        const juce::uint16 version    = (zip64 ? 45 : 20);
+        const juce::uint16 flags      = (0x0008 | 0x0800); // data descriptor | utf-8 name
+        const juce::uint16 dos_time   = static_cast<juce::uint16>((modificationTime.getHours()   << 11)
+                                                                | (modificationTime.getMinutes() << 5)
+                                                                | (modificationTime.getSeconds() >> 1));
+        const juce::uint16 dos_date   = static_cast<juce::uint16>(((modificationTime.getYear() - 1980) << 9)
+                                                                | ((modificationTime.getMonth() + 1) << 5)
+                                                                | modificationTime.getDayOfMonth());
+        const juce::uint16 name_size  = static_cast<juce::uint16>(entryName.getNumBytesAsUTF8());
+        const juce::uint16 extra_size = (zip64 ? 20 : 0);
+        
+        const auto write_zip64_extra = [&output](juce::uint64 uncompressed, juce::uint64 compressed)
+        {
+            (void) output.writeShort(0x0001);
+            (void) output.writeShort(16);
+            (void) output.writeInt64(static_cast<juce::int64>(uncompressed));
+            (void) output.writeInt64(static_cast<juce::int64>(compressed));
+        };
+        
+        // Local file header
+        const juce::int64 header_start = output.getPosition();
+        (void) output.writeInt(0x04034b50);
+        (void) output.writeShort(static_cast<short>(version));
+        (void) output.writeShort(static_cast<short>(flags));
+        (void) output.writeShort(8);
+        (void) output.writeShort(static_cast<short>(dos_time));
+        (void) output.writeShort(static_cast<short>(dos_date));
+        (void) output.writeInt(0);
+        (void) output.writeInt(zip64 ? -1 : 0);
+        (void) output.writeInt(zip64 ? -1 : 0);
+        (void) output.writeShort(static_cast<short>(name_size));
+        (void) output.writeShort(static_cast<short>(extra_size));
+        (void) output.write(entryName.toRawUTF8(), name_size);
+        
+        if (zip64)
         {
-            juce::FileOutputStream           fos (dest);
-            juce::GZIPCompressorOutputStream gzos(fos, compressionLevel);
+            write_zip64_extra(0, 0);
+        }
+        
+        // Entry data
+        const juce::int64 data_start   = output.getPosition();
+        juce::uint32      crc          = 0;
+        juce::uint64      uncompressed = 0;
+        
+        {
+            juce::GZIPCompressorOutputStream deflater(output, options.compressionLevel,
+                                                      juce::GZIPCompressorOutputStream::windowBitsRaw);
             
-            if (!gzos.writeText(src.loadFileAsString(), false, false, nullptr))
+            const bool result = pumpStream(input, options.chunkSize, [&](const char *data, std::size_t size)
+            {
+                crc           = updateCrc(crc, data, size);
+                uncompressed += size;
+                
+                return deflater.write(data, size);
+            });
+            
+            if (!result)
             {
                 return false;
             }
             
-            gzos.flush();
+            deflater.flush();
+        }
+        
+        const juce::uint64 compressed = static_cast<juce::uint64>(output.getPosition() - data_start);
+        
+        // Data descriptor
+        (void) output.writeInt(0x08074b50);
+        (void) output.writeInt(static_cast<int>(crc));
+        
+        if (zip64)
+        {
+            (void) output.writeInt64(static_cast<juce::int64>(compressed));
+            (void) output.writeInt64(static_cast<juce::int64>(uncompressed));
         }
         else
         {
-            return src.copyFileTo(dest);
+            (void) output.writeInt(static_cast<int>(compressed));
+            (void) output.writeInt(static_cast<int>(uncompressed));
         }
         
-        return true;
+        // Central directory
+        const juce::int64 directory_start = output.getPosition();
+        (void) output.writeInt(0x02014b50);
+        (void) output.writeShort(static_cast<short>(version));
+        (void) output.writeShort(static_cast<short>(version));
+        (void) output.writeShort(static_cast<short>(flags));
+        (void) output.writeShort(8);
+        (void) output.writeShort(static_cast<short>(dos_time));
+        (void) output.writeShort(static_cast<short>(dos_date));
+        (void) output.writeInt(static_cast<int>(crc));
+        (void) output.writeInt(zip64 ? -1 : static_cast<int>(compressed));
+        (void) output.writeInt(zip64 ? -1 : static_cast<int>(uncompressed));
+        (void) output.writeShort(static_cast<short>(name_size));
+        (void) output.writeShort(static_cast<short>(extra_size));
+        (void) output.writeShort(0);
+        (void) output.writeShort(0);
+        (void) output.writeShort(0);
+        (void) output.writeInt(0);
+        (void) output.writeInt(static_cast<int>(header_start));
+        (void) output.write(entryName.toRawUTF8(), name_size);
+        
+        if (zip64)
+        {
+            write_zip64_extra(uncompressed, compressed);
+        }
+        
+        const juce::int64 directory_end  = output.getPosition();
+        const juce::int64 directory_size = (directory_end - directory_start);
+        
+        if (zip64)
+        {
+            // Zip64 end of central directory record and locator
+            (void) output.writeInt(0x06064b50);
+            (void) output.writeInt64(44);
+            (void) output.writeShort(45);
+            (void) output.writeShort(45);
+            (void) output.writeInt(0);
+            (void) output.writeInt(0);
+            (void) output.writeInt64(1);
+            (void) output.writeInt64(1);
+            (void) output.writeInt64(directory_size);
+            (void) output.writeInt64(directory_start);
+            
+            (void) output.writeInt(0x07064b50);
+            (void) output.writeInt(0);
+            (void) output.writeInt64(directory_end);
+            (void) output.writeInt(1);
+        }
+        
+        // End of central directory
+        (void) output.writeInt(0x06054b50);
+        (void) output.writeShort(0);
+        (void) output.writeShort(0);
+        (void) output.writeShort(1);
+        (void) output.writeShort(1);
+        (void) output.writeInt(static_cast<int>(directory_size));
+        (void) output.writeInt(zip64 ? -1 : static_cast<int>(directory_start));
+        (void) output.writeShort(0);
+        
+        return !output.getStatus().failed();
+    }
+    
+#if JAUT_OPTLIB_ZSTD
+    bool writeZstd(juce::FileInputStream &input, juce::FileOutputStream &output, const Options &options)
+    {
+        const std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> context(ZSTD_createCCtx(), &ZSTD_freeCCtx);
+        
+        if (!context)
+        {
+            return false;
+        }
+        
+        // Level 0 is zstd's way of asking for its default level
+        (void) ZSTD_CCtx_setParameter(context.get(), ZSTD_c_compressionLevel, options.compressionLevel);
+        
+        const std::size_t     out_size = ZSTD_CStreamOutSize();
+        juce::HeapBlock<char> out_chunk(out_size);
+        
+        const auto compress = [&](const char *data, std::size_t size, ZSTD_EndDirective mode)
+        {
+            ZSTD_inBuffer in_buffer { data, size, 0 };
+            
+            for (;;)
+            {
+                ZSTD_outBuffer    out_buffer { out_chunk.get(), out_size, 0 };
+                const std::size_t remaining = ZSTD_compressStream2(context.get(), &out_buffer, &in_buffer, mode);
+                
+                if (ZSTD_isError(remaining) || !output.write(out_chunk.get(), out_buffer.pos))
+                {
+                    return false;
+                }
+                
+                if (mode == ZSTD_e_end ? (remaining == 0) : (in_buffer.pos == in_buffer.size))
+                {
+                    return true;
+                }
+            }
+        };
+        
+        const bool result = pumpStream(input, options.chunkSize, [&compress](const char *data, std::size_t size)
+        {
+            return compress(data, size, ZSTD_e_continue);
+        });
+        
+        return (result && compress(nullptr, 0, ZSTD_e_end));
+    }
+#endif
+    
+    //==================================================================================================================
+    bool copyTo(const juce::File &src, const juce::File &dest, const juce::String &entryName, const Options &options,
+                bool moveSource)
+    {
+        const juce::String path = dest.getFileName();
+        
+        if (const juce::File parent = dest.getParentDirectory();
+            !parent.exists())
+        {
+            if (parent.createDirectory().failed())
+            {
+                throw jaut::LogIOException("could not create log archive parent structure");
+            }
+        }
+        
+        const bool is_zip  = path.endsWith(".zip");
+        const bool is_gzip = path.endsWith(".gz");
+        
+    #if JAUT_OPTLIB_ZSTD
+        const bool is_zstd = path.endsWith(".zst");
+    #else
+        constexpr bool is_zstd = false;
+    #endif
+        
+        if (!is_zip && !is_gzip && !is_zstd)
+        {
+            // A staged log is deleted after rotation anyway, so we can just take it instead of copying it
+            return (moveSource ? src.moveFileTo(dest) : src.copyFileTo(dest));
+        }
+        
+        juce::FileInputStream  fis(src);
+        juce::FileOutputStream fos(dest);
+        
+        if (fis.failedToOpen() || fos.failedToOpen() || fos.truncate().failed())
+        {
+            return false;
+        }
+        
+        if (is_zip)
+        {
+            return writeZip(fis, fos, entryName, src.getLastModificationTime(), options);
+        }
+        
+    #if JAUT_OPTLIB_ZSTD
+        if (is_zstd)
+        {
+            return writeZstd(fis, fos, options);
+        }
+    #endif
+        
+        return writeGzip(fis, fos, options);
     }
 }
 //======================================================================================================================
@@ -104,6 +403,7 @@ namespace jaut
           pattern(std::move(parPattern))
     {
         jassert(options.min >= 0 && options.min <= parOptions.max);
+        jassert(options.chunkSize > 0);
     }
     
     StrategyPattern::StrategyPattern(juce::String parPattern)
@@ -116,6 +416,10 @@ namespace jaut
         const juce::String formatted  = juce::Time::getCurrentTime().formatted(pattern);
         const juce::File   file_start = juce::File::getSpecialLocation(juce::File::currentExecutableFile);
         
+        // The rotation source might be a staged copy, archives should still carry the name of the log
+        const juce::String entry_name   = parRotationManager.getLogFile().getFileName();
+        const bool         staged_input = (parRotationManager.getRotationSource() != parRotationManager.getLogFile());
+        
         if (!formatted.contains("%i"))
         {
             juce::File dest = file_start.getSiblingFile(formatted);
@@ -130,10 +434,10 @@ namespace jaut
                 (void) dest.deleteFile();
             }
             
-            if (!::copyTo(parRotationManager.getLogFile(), dest, options.compressionLevel))
+            if (!::copyTo(parRotationManager.getRotationSource(), dest, entry_name, options, staged_input))
             {
                 throw LogIOException("could not rotate log '"
-                                     + parRotationManager.getLogFile().getFullPathName() + "'");
+                                     + parRotationManager.getRotationSource().getFullPathName() + "'");
             }
             
             return dest;
@@ -179,10 +483,11 @@ namespace jaut
                     }
                 }
                 
-                if (!::copyTo(parRotationManager.getLogFile(), archive_file, options.compressionLevel))
+                if (!::copyTo(parRotationManager.getRotationSource(), archive_file, entry_name, options,
+                              staged_input))
                 {
                     throw LogIOException("could not rotate log '"
-                                         + parRotationManager.getLogFile().getFullPathName() + "'");
+                                         + parRotationManager.getRotationSource().getFullPathName() + "'");
                 }
                 
                 return archive_file;
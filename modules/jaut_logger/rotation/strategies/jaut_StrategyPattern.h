@@ -34,6 +34,7 @@
 
 #pragma once
 
+#include <jaut_logger/jaut_logger_define.h>
 #include <jaut_logger/jaut_LogMessage.h>
 
 #include <jaut_core/define/jaut_Define.h>
@@ -56,6 +57,7 @@ namespace jaut
         static constexpr int default_max              = 5;
         static constexpr int default_compressionLevel = 6;
         static constexpr int default_overwrite        = true;
+        static constexpr int default_chunkSize        = (64 * 1024);
         
         //==============================================================================================================
         struct Options
@@ -72,12 +74,21 @@ namespace jaut
             /**
              *  For compressed archives, what compression level should be used.
              *  (0 to 9, where 0 is no compression and 9 is max compression)<br>
+             *  For zstd archives, this is passed to zstd as is, where 0 means zstd's default level and
+             *  negative values favour speed over ratio even more.<br>
              *  For non compressed archives, this option will be ignored.
              */
             int compressionLevel = default_compressionLevel;
             
             /** Whether log archives with the same name should be overwritten by newer archives. */
             bool overwrite = default_overwrite;
+            
+            /**
+             *  The size of the chunks the log is read in while compressing it.<br>
+             *  This is the most of the log that is held in memory at once, no matter how big the log is.
+             *  (in bytes)
+             */
+            int chunkSize = default_chunkSize;
         };
         
         //==============================================================================================================
@@ -91,7 +102,8 @@ namespace jaut
          *  <br><br>
          *  Also note that, the extension that is used, will determine the file format.<br>
          *  Available are ".zip" to store them in zip format, ".gz" to store them in gzip format and any other
-         *  extension to store it as a plain text file with no compression.
+         *  extension to store it as a plain text file with no compression.<br>
+         *  If JAUT_OPTLIB_ZSTD is enabled, ".zst" will store them in zstd format.
          *  <br><br>
          *  Valid variables, that can be part of the name, are:
          *  <ul>
@@ -116,7 +128,8 @@ namespace jaut
          *  <br><br>
          *  Also note that, the extension that is used, will determine the file format.<br>
          *  Available are ".zip" to store them in zip format, ".gz" to store them in gzip format and any other
-         *  extension to store it as a plain text file with no compression.
+         *  extension to store it as a plain text file with no compression.<br>
+         *  If JAUT_OPTLIB_ZSTD is enabled, ".zst" will store them in zstd format.
          *  <br><br>
          *  Valid variables, that can be part of the name, are:
          *  <ul>
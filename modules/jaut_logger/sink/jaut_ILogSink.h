@@ -35,6 +35,7 @@
 #pragma once
 
 #include <jaut_logger/jaut_LogMessage.h>
+#include <jaut_logger/jaut_LogMetrics.h>
 #include <jaut_logger/format/jaut_LogFormatPattern.h>
 
 #include <juce_core/juce_core.h>
@@ -92,5 +93,15 @@ namespace jaut
          */
         JAUT_NODISCARD
         virtual const ILogFormat* getFormatter() const = 0;
+        
+        /**
+         *  Gets the figures this sink collected about formatting and writing its output.<br>
+         *  These are only collected if JAUT_LOGGER_METRICS is enabled, the returned object may be read from any
+         *  thread at any time.
+         *  
+         *  @return The sink's metrics or nullptr if it doesn't collect any
+         */
+        JAUT_NODISCARD
+        virtual const LogSinkMetrics* getMetrics() const noexcept { return nullptr; }
     };
 }
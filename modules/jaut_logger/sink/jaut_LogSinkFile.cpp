@@ -80,7 +80,15 @@ namespace jaut
         
         try
         {
-            stream.open(logFile.getFullPathName().toStdString(), std::ios::binary | std::ios::app);
+            if (   options.inPlace && !options.append && options.formatter->supportsReplacingFormatter()
+                && (document = options.formatter->openDocument(content)).has_value())
+            {
+                openDocument();
+            }
+            else
+            {
+                stream.open(logFile.getFullPathName().toStdString(), std::ios::binary | std::ios::app);
+            }
         }
         catch (const std::exception &ex)
         {
@@ -100,22 +108,54 @@ namespace jaut
         
         ILogFormat &formatter = *options.formatter;
         
+        if (document.has_value())
+        {
+            printInPlace(parLogMessage);
+            return;
+        }
+        
         if (!options.append)
         {
             clearContents();
             
             if (formatter.supportsReplacingFormatter())
             {
-                stream << (content = formatter.formatReplace(parLogMessage, content));
+                #if JAUT_LOGGER_METRICS
+                const detail::MetricsStopwatch format_stopwatch;
+                #endif
+                
+                content = formatter.formatReplace(parLogMessage, content);
+                
+                #if JAUT_LOGGER_METRICS
+                metrics.recordFormat(format_stopwatch.getElapsed());
+                #endif
+                
+                stream << content;
                 return;
             }
         }
         
-        stream << formatter.format(parLogMessage);
+        buffer.clear();
+        
+        #if JAUT_LOGGER_METRICS
+        const detail::MetricsStopwatch format_stopwatch;
+        #endif
+        
+        formatter.formatTo(buffer, parLogMessage);
+        
+        #if JAUT_LOGGER_METRICS
+        metrics.recordFormat(format_stopwatch.getElapsed());
+        #endif
+        
+        stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
     }
     
     void LogSinkFile::flush()
     {
+        #if JAUT_LOGGER_METRICS
+        const detail::ScopedMetricsTimer write_timer(metrics.writeTime);
+        #endif
+        
         if (stream.is_open())
         {
             stream << std::flush;
@@ -165,6 +205,13 @@ namespace jaut
         return options.formatter.get().get();
     }
     
+    #if JAUT_LOGGER_METRICS
+    const LogSinkMetrics* LogSinkFile::getMetrics() const noexcept
+    {
+        return &metrics;
+    }
+    #endif
+    
     //==================================================================================================================
     void LogSinkFile::clearContents()
     {
@@ -182,6 +229,60 @@ namespace jaut
             throw LogIOException(ex.what());
         }
     }
+    
+    void LogSinkFile::openDocument()
+    {
+        // The file is only rewritten this one time, from here on out we will only ever overwrite the closing sequence
+        stream.open(logFile.getFullPathName().toStdString(), std::ios::binary | std::ios::trunc);
+        
+        const juce::String data = document->head + document->closing;
+        stream.write(data.toRawUTF8(), static_cast<std::streamsize>(data.getNumBytesAsUTF8()));
+        
+        documentEnd = static_cast<std::streamoff>(document->head.getNumBytesAsUTF8());
+        content     = juce::String();
+    }
+    
+    void LogSinkFile::printInPlace(const LogMessage &parLogMessage)
+    {
+        const auto append_string = [this](const juce::String &text)
+        {
+            const char *const data = text.toRawUTF8();
+            buffer.append(data, data + text.getNumBytesAsUTF8());
+        };
+        
+        buffer.clear();
+        
+        if (document->hasEvents)
+        {
+            append_string(document->separator);
+        }
+        
+        #if JAUT_LOGGER_METRICS
+        const detail::MetricsStopwatch format_stopwatch;
+        #endif
+        
+        options.formatter->formatEventTo(buffer, parLogMessage);
+        
+        #if JAUT_LOGGER_METRICS
+        metrics.recordFormat(format_stopwatch.getElapsed());
+        #endif
+        
+        const std::streamoff event_end = documentEnd + static_cast<std::streamoff>(buffer.size());
+        append_string(document->closing);
+        
+        try
+        {
+            stream.seekp(documentEnd);
+            stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        }
+        catch (const std::exception &ex)
+        {
+            throw LogIOException(ex.what());
+        }
+        
+        documentEnd         = event_end;
+        document->hasEvents = true;
+    }
 }
 //======================================================================================================================
 // endregion LogSinkFile
@@ -59,6 +59,7 @@ namespace jaut
         static constexpr bool default_buffered = true;
         static constexpr int  default_bufferSize = 4096;
         static constexpr bool default_append = true;
+        static constexpr bool default_inPlace = false;
         
         //==============================================================================================================
         struct Options
@@ -80,6 +81,16 @@ namespace jaut
              *  If supported and enabled, this will enable the replacing version of the formatter.
              */
             bool append = default_append;
+            
+            /**
+             *  If append is false and the formatter supports in-place documents, like jaut::LogFormatJson and
+             *  jaut::LogFormatXml do, new events will be written over the closing sequence of the document in the
+             *  log file instead of rewriting the whole file for every new event.
+             *  <br><br>
+             *  This keeps the log file valid at all times, but unlike the replacing formatter, the cost of logging an
+             *  event doesn't grow with the size of the log file.
+             */
+            bool inPlace = default_inPlace;
         };
         
         //==============================================================================================================
@@ -129,16 +140,31 @@ namespace jaut
         JAUT_NODISCARD
         const ILogFormat* getFormatter() const override;
         
+        #if JAUT_LOGGER_METRICS
+        JAUT_NODISCARD
+        const LogSinkMetrics* getMetrics() const noexcept override;
+        #endif
+        
     private:
         std::vector<char> streamBuf;
         
-        std::ofstream stream;
-        Options       options;
-        juce::File    logFile;
-        juce::String  content;
+        std::ofstream      stream;
+        Options            options;
+        juce::File         logFile;
+        juce::String       content;
+        fmt::memory_buffer buffer;
+        
+        std::optional<ILogFormat::DocumentLayout> document;
+        std::streamoff                            documentEnd { 0 };
+        
+        #if JAUT_LOGGER_METRICS
+        LogSinkMetrics metrics;
+        #endif
         
         //==============================================================================================================
         void clearContents();
+        void openDocument();
+        void printInPlace(const LogMessage &logMessage);
         
         //==============================================================================================================
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LogSinkFile)
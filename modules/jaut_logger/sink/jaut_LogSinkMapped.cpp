@@ -0,0 +1,385 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogSinkMapped.cpp
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+
+#pragma once
+
+#include <jaut_logger/sink/jaut_LogSinkMapped.h>
+
+#if JUCE_LINUX || JUCE_BSD || JUCE_MAC || JUCE_IOS || JUCE_ANDROID
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+
+
+//**********************************************************************************************************************
+// region Namespace
+//======================================================================================================================
+namespace
+{
+    // While a segment is open, it ends in a trailer that holds the number of bytes that were logged so far.
+    // This way a log can be continued after a crash, no matter what bytes the formatter's output ends in.
+    constexpr char        trailerTag[8] = { 'J', 'A', 'U', 'T', 'M', 'A', 'P', '1' };
+    constexpr std::size_t trailerSize   = (sizeof(trailerTag) + sizeof(std::uint64_t));
+    
+    //==================================================================================================================
+    JAUT_NODISCARD
+    std::size_t readLoggedSize(int fd, std::size_t fileSize) noexcept
+    {
+        char trailer[trailerSize];
+        
+        // Without a trailer, the file was closed properly and was already truncated to what was logged
+        if (fileSize < trailerSize
+            || ::pread(fd, trailer, trailerSize, static_cast<off_t>(fileSize - trailerSize))
+                   != static_cast<ssize_t>(trailerSize)
+            || std::memcmp(trailer, trailerTag, sizeof(trailerTag)) != 0)
+        {
+            return fileSize;
+        }
+        
+        std::uint64_t logged_size;
+        std::memcpy(&logged_size, trailer + sizeof(trailerTag), sizeof(logged_size));
+        
+        return (logged_size <= (fileSize - trailerSize) ? static_cast<std::size_t>(logged_size) : fileSize);
+    }
+    
+    void writeLoggedSize(char *trailer, std::size_t loggedSize) noexcept
+    {
+        const auto logged_size = static_cast<std::uint64_t>(loggedSize);
+        std::memcpy(trailer + sizeof(trailerTag), &logged_size, sizeof(logged_size));
+    }
+}
+//======================================================================================================================
+// endregion Namespace
+//**********************************************************************************************************************
+// region LogSinkMapped
+//======================================================================================================================
+namespace jaut
+{
+    //==================================================================================================================
+    LogSinkMapped::LogSinkMapped(juce::File parLogFile)
+        : LogSinkMapped(std::move(parLogFile), Options{})
+    {}
+    
+    LogSinkMapped::LogSinkMapped(juce::File parLogFile, Options parOptions)
+        : rotationManager(parLogFile, parOptions.rotationPolicy, parOptions.rotationStrategy,
+                          LogRotationManager::Options{ parOptions.asyncRotation }),
+          options        (std::move(parOptions)),
+          logFile        (std::move(parLogFile))
+    {
+        if (const juce::Result result = logFile.create();
+            result.failed())
+        {
+            throw LogIOException("could not create log file '" + logFile.getFullPathName() + "': "
+                                 + result.getErrorMessage());
+        }
+        
+        rotationManager.eventBeforeRotation += jaut::makeHandler(&LogSinkMapped::closeOnRotation, this);
+        rotationManager.eventLogRenewed     += jaut::makeHandler(&LogSinkMapped::openOnRotation,  this);
+        rotationManager.eventAfterRotation  += jaut::makeHandler(eventLogRotated);
+        
+        openSegment(0);
+    }
+    
+    LogSinkMapped::~LogSinkMapped()
+    {
+        closeSegment();
+    }
+    
+    //==================================================================================================================
+    void LogSinkMapped::print(const LogMessage &parLogMessage)
+    {
+        if (!segment)
+        {
+            throw LogIOException("segment could not be mapped");
+        }
+        
+        renderMessage(parLogMessage);
+        
+        const std::size_t offset      = writeOffset.load(std::memory_order_relaxed);
+        bool              has_rotated = rotationManager.tryRotateLogs(parLogMessage, buffer.size());
+        
+        if (!has_rotated && offset > 0 && (offset + buffer.size()) > mappedSize)
+        {
+            rotationManager.forceRotateLogs();
+            has_rotated = true;
+        }
+        
+        // Formatters that keep state per log were reset by the new log's header, so the output has to start over
+        if (has_rotated)
+        {
+            renderMessage(parLogMessage);
+        }
+        
+        write(buffer.data(), buffer.size());
+    }
+    
+    void LogSinkMapped::flush()
+    {
+        if (!options.syncOnFlush || !segment)
+        {
+            return;
+        }
+        
+        const std::size_t offset = writeOffset.load(std::memory_order_relaxed);
+        
+        if (offset == syncOffset)
+        {
+            return;
+        }
+        
+        // msync needs the start of the range to be page aligned
+        const auto        page_size  = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        const std::size_t sync_start = (syncOffset / page_size) * page_size;
+        
+        if (::msync(segment + sync_start, (offset - sync_start), MS_SYNC) != 0)
+        {
+            throw LogIOException("could not synchronise log file '" + logFile.getFullPathName() + "': "
+                                 + juce::String(std::strerror(errno)));
+        }
+        
+        syncOffset = offset;
+    }
+    
+    //==================================================================================================================
+    void LogSinkMapped::onOpen()
+    {
+        ILogFormat::Util::printHeader(getFormatter(), [this](const juce::String &header)
+        {
+            const juce::String line = header + '\n';
+            write(line.toRawUTF8(), line.getNumBytesAsUTF8());
+        });
+    }
+    
+    void LogSinkMapped::onClose()
+    {
+        ILogFormat::Util::printFooter(getFormatter(), [this](const juce::String &footer)
+        {
+            const juce::String line = footer + '\n';
+            write(line.toRawUTF8(), line.getNumBytesAsUTF8());
+        });
+        
+        flush();
+    }
+    
+    //==================================================================================================================
+    const juce::File& LogSinkMapped::getLogFile() const noexcept
+    {
+        return logFile;
+    }
+    
+    const LogSinkMapped::Options& LogSinkMapped::getOptions() const noexcept
+    {
+        return options;
+    }
+    
+    std::size_t LogSinkMapped::getWrittenBytes() const noexcept
+    {
+        return writeOffset.load(std::memory_order_acquire);
+    }
+    
+    const ILogFormat* LogSinkMapped::getFormatter() const
+    {
+        return options.formatter.get().get();
+    }
+    
+    #if JAUT_LOGGER_METRICS
+    const LogSinkMetrics* LogSinkMapped::getMetrics() const noexcept
+    {
+        return &metrics;
+    }
+    #endif
+    
+    //==================================================================================================================
+    void LogSinkMapped::openSegment(std::size_t parMinimumSize)
+    {
+        const auto fail = [this](const juce::String &message)
+        {
+            const juce::String error(std::strerror(errno));
+            
+            if (fd >= 0)
+            {
+                (void) ::close(fd);
+                fd = -1;
+            }
+            
+            throw LogIOException(message + " '" + logFile.getFullPathName() + "': " + error);
+        };
+        
+        fd = ::open(logFile.getFullPathName().toRawUTF8(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        
+        if (fd < 0)
+        {
+            fail("could not open log file");
+        }
+        
+        struct stat file_stat {};
+        
+        if (::fstat(fd, &file_stat) != 0)
+        {
+            fail("could not read log file");
+        }
+        
+        const auto        file_size = static_cast<std::size_t>(file_stat.st_size);
+        const std::size_t offset    = ::readLoggedSize(fd, file_size);
+        const std::size_t capacity  = std::max({ options.segmentSize, offset, parMinimumSize, std::size_t(1) });
+        const std::size_t map_size  = (capacity + ::trailerSize);
+        
+        // The file has to end exactly where the trailer is, or a stale trailer could be read after a crash
+        if (file_size > map_size && ::ftruncate(fd, static_cast<off_t>(map_size)) != 0)
+        {
+            fail("could not allocate segment for log file");
+        }
+        
+        if (file_size < map_size)
+        {
+            #if JUCE_LINUX || JUCE_ANDROID
+            // Reserve the blocks up front, so that we don't run out of disk space halfway through the segment
+            if (const int result = ::posix_fallocate(fd, 0, static_cast<off_t>(map_size)); result != 0)
+            {
+                errno = result;
+                
+                if ((result != EINVAL && result != EOPNOTSUPP)
+                    || ::ftruncate(fd, static_cast<off_t>(map_size)) != 0)
+                {
+                    fail("could not allocate segment for log file");
+                }
+            }
+            #else
+            if (::ftruncate(fd, static_cast<off_t>(map_size)) != 0)
+            {
+                fail("could not allocate segment for log file");
+            }
+            #endif
+        }
+        
+        void *const memory = ::mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        
+        if (memory == MAP_FAILED)
+        {
+            fail("could not map log file");
+        }
+        
+        segment    = static_cast<char*>(memory);
+        mappedSize = capacity;
+        
+        std::memcpy(segment + mappedSize, ::trailerTag, sizeof(::trailerTag));
+        ::writeLoggedSize(segment + mappedSize, offset);
+        
+        writeOffset.store(offset, std::memory_order_release);
+        syncOffset = offset;
+        
+        // The file is as big as the segment, but to rotation policies, only what was logged counts
+        rotationManager.reportLogSize(offset);
+    }
+    
+    void LogSinkMapped::closeSegment()
+    {
+        if (segment)
+        {
+            (void) ::munmap(segment, (mappedSize + ::trailerSize));
+            segment    = nullptr;
+            mappedSize = 0;
+        }
+        
+        if (fd >= 0)
+        {
+            // Cut off the unused rest of the segment and the trailer, so that the file contains only what was actually
+            // logged
+            (void) ::ftruncate(fd, static_cast<off_t>(writeOffset.load(std::memory_order_relaxed)));
+            (void) ::close(fd);
+            fd = -1;
+        }
+    }
+    
+    void LogSinkMapped::write(const char *parData, std::size_t parSize)
+    {
+        #if JAUT_LOGGER_METRICS
+        const detail::ScopedMetricsTimer write_timer(metrics.writeTime);
+        #endif
+        
+        const std::size_t offset = writeOffset.load(std::memory_order_relaxed);
+        
+        if ((offset + parSize) > mappedSize)
+        {
+            // Only happens if a single event doesn't fit into a segment, so we need to make this one bigger
+            closeSegment();
+            openSegment(offset + parSize);
+        }
+        
+        std::memcpy(segment + offset, parData, parSize);
+        ::writeLoggedSize(segment + mappedSize, (offset + parSize));
+        writeOffset.store(offset + parSize, std::memory_order_release);
+        
+        rotationManager.reportWritten(parSize);
+    }
+    
+    void LogSinkMapped::renderMessage(const LogMessage &parLogMessage)
+    {
+        buffer.clear();
+        
+        #if JAUT_LOGGER_METRICS
+        const detail::MetricsStopwatch format_stopwatch;
+        #endif
+        
+        options.formatter->formatTo(buffer, parLogMessage);
+        
+        #if JAUT_LOGGER_METRICS
+        metrics.recordFormat(format_stopwatch.getElapsed());
+        #endif
+    }
+    
+    //==================================================================================================================
+    void LogSinkMapped::closeOnRotation(const juce::File&)
+    {
+        onClose();
+        closeSegment();
+    }
+    
+    void LogSinkMapped::openOnRotation(const juce::File&)
+    {
+        openSegment(0);
+        onOpen();
+    }
+}
+//======================================================================================================================
+// endregion LogSinkMapped
+//**********************************************************************************************************************
+#endif
@@ -0,0 +1,248 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogSinkMapped.h
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+
+#pragma once
+
+#include <jaut_logger/exception/jaut_LogIOException.h>
+#include <jaut_logger/format/jaut_ILogFormat.h>
+#include <jaut_logger/rotation/jaut_LogRotationManager.h>
+#include <jaut_logger/rotation/policies/jaut_PolicyDaily.h>
+#include <jaut_logger/rotation/strategies/jaut_StrategyPattern.h>
+#include <jaut_logger/sink/jaut_ILogSink.h>
+
+#include <jaut_core/define/jaut_Define.h>
+
+#include <juce_core/juce_core.h>
+
+
+
+#if JUCE_LINUX || JUCE_BSD || JUCE_MAC || JUCE_IOS || JUCE_ANDROID
+namespace jaut
+{
+    /**
+     *  A Logger output sink for log files that writes into a memory mapped segment of the log file, for POSIX
+     *  systems only.<br>
+     *  The segment is allocated up front and every event is copied straight into the mapped memory, so there is no
+     *  system call involved in writing events at all.<br>
+     *  Since the pages belong to the kernel, all written events will survive the process crashing.
+     *  <br><br>
+     *  Once a segment is full, the log will be rotated through the rotation strategy and a new segment will be
+     *  allocated.<br>
+     *  Apart from that, logs will also be rotated whenever the rotation policy demands it.
+     *  While the log file is open it always has the size of the entire segment, but the sink reports the logical
+     *  size of the log to the rotation manager, so size based policies like jaut::PolicySizeLimit only see the bytes
+     *  that were actually written.
+     *  <br><br>
+     *  While a segment is open, a small trailer after it keeps track of how many bytes were written.
+     *  When the sink is closed, the log file will be truncated to the actual size of the written events.<br>
+     *  If the process crashed, the trailer remains, and a new sink opening the same file will continue right after
+     *  the last written event, so this works with any formatter, even binary ones whose events can end in zero bytes.
+     *  <br><br>
+     *  This sink does not support replacing formatters.
+     */
+    class JAUT_API LogSinkMapped : public ILogSink
+    {
+    public:
+        /**
+         *  The default rotation policy for the mapped file sink.<br>
+         *  By default this will be a daily file sink that rotates at midnight every day.
+         */
+        inline static RotationPolicy defaultRotationPolicy = PolicyDaily(0, 0);
+        
+        /**
+         *  The default rotation strategy.<br>
+         *  This will rotate all files and save them as zip archive with their date and time of the rotation as name.
+         */
+        inline static RotationStrategy defaultRotationStrategy = StrategyPattern("log_%Y-%m-%d_%H-%M-%S.zip");
+        
+        static constexpr std::size_t default_segmentSize   = (64 * 1024 * 1024);
+        static constexpr bool        default_syncOnFlush   = false;
+        static constexpr bool        default_asyncRotation = LogRotationManager::default_async;
+        
+        //==============================================================================================================
+        struct Options
+        {
+            /** 
+             *  The rotation policy.<br>
+             *  This determines the condition under which a log should be rotated, apart from the segment being full.
+             *  
+             *  @see jaut::RotationPolicy
+             */
+            NonNull<RotationPolicy> rotationPolicy = defaultRotationPolicy;
+            
+            /**
+             *  The rotation strategy.<br>
+             *  This will allow you defining how logs are rotated and what should happen to old logs.
+             *  
+             *  @see jaut::RotationStrategy
+             */
+            NonNull<RotationStrategy> rotationStrategy = defaultRotationStrategy;
+            
+            /**
+             *  The formatter to be used by this sink.
+             *  @see jaut::LogFormat
+             */
+            NonNull<std::unique_ptr<ILogFormat>> formatter = std::make_unique<DefaultFormatterType>();
+            
+            /**
+             *  The size of a segment, this is the amount of bytes a log file can hold before it is rotated.
+             *  (in bytes)
+             */
+            std::size_t segmentSize = default_segmentSize;
+            
+            /**
+             *  Determines whether the written events should be synchronised with the disk on every flush.<br>
+             *  Without this, events still survive a crash of the process but not necessarily a crash of the system.
+             */
+            bool syncOnFlush = default_syncOnFlush;
+            
+            /**
+             *  Whether rotated logs should be archived on a background thread.<br>
+             *  If this is true, rotating will only rename the log file on the logging thread and leave compressing
+             *  and shifting archives to the rotation thread, in which case eventLogRotated will be raised on the
+             *  rotation thread.
+             *  
+             *  @see jaut::LogRotationManager::Options::async
+             */
+            bool asyncRotation = default_asyncRotation;
+        };
+        
+        //==============================================================================================================
+        using LogRotatedHandler = LogRotationManager::AfterRotationHandler;
+        
+        //==============================================================================================================
+        /**
+         *  This event will be raised whenever the log file was rotated.<br>
+         *  Note that, while adding events is thread-safe, the event being raised is not necessarily, as
+         *  this will always be raised on the thread the log messages are processed on,
+         *  or on the rotation thread if Options::asyncRotation is enabled.
+         *
+         *  @param par1 The newly rotated log file/archive
+         */
+        Event<LogRotatedHandler, juce::CriticalSection> eventLogRotated;
+        
+        //==============================================================================================================
+        /**
+         *  Creates a new mapped file logging sink.
+         *  @param logFile The file to log to
+         *  
+         *  @throw jaut::LogIOException If the segment could not be allocated or mapped
+         */
+        explicit LogSinkMapped(juce::File logFile);
+        
+        /**
+         *  Creates a new mapped file logging sink.
+         *  
+         *  @param logFile The file to log to
+         *  @param options The options for this file sink
+         *  
+         *  @throw jaut::LogIOException If the segment could not be allocated or mapped
+         */
+        LogSinkMapped(juce::File logFile, Options options);
+        
+        ~LogSinkMapped() override;
+        
+        //==============================================================================================================
+        void print(const LogMessage &logMessage) override;
+        void flush()                             override;
+        
+        //==============================================================================================================
+        void onOpen()  override;
+        void onClose() override;
+        
+        //==============================================================================================================
+        /**
+         *  Gets the file that has been set to be the log file.
+         *  @return The current log file
+         */
+        JAUT_NODISCARD
+        const juce::File& getLogFile() const noexcept;
+        
+        /**
+         *  Gets the options of this file sink.
+         *  @return The options
+         */
+        JAUT_NODISCARD
+        const Options& getOptions() const noexcept;
+        
+        /**
+         *  Gets the amount of bytes that were written to the current segment.<br>
+         *  This is safe to be called from any thread.
+         *  
+         *  @return The amount of written bytes
+         */
+        JAUT_NODISCARD
+        std::size_t getWrittenBytes() const noexcept;
+        
+        JAUT_NODISCARD
+        const ILogFormat* getFormatter() const override;
+        
+        #if JAUT_LOGGER_METRICS
+        JAUT_NODISCARD
+        const LogSinkMetrics* getMetrics() const noexcept override;
+        #endif
+        
+    private:
+        LogRotationManager rotationManager;
+        
+        Options            options;
+        juce::File         logFile;
+        fmt::memory_buffer buffer;
+        
+        std::atomic<std::size_t> writeOffset { 0 };
+        std::size_t              syncOffset  { 0 };
+        std::size_t              mappedSize  { 0 };
+        char                     *segment    { nullptr };
+        int                      fd          { -1 };
+        
+        #if JAUT_LOGGER_METRICS
+        LogSinkMetrics metrics;
+        #endif
+        
+        //==============================================================================================================
+        void openSegment(std::size_t minimumSize);
+        void closeSegment();
+        void write(const char *data, std::size_t size);
+        void renderMessage(const LogMessage &logMessage);
+        
+        //==============================================================================================================
+        void closeOnRotation(const juce::File&);
+        void openOnRotation(const juce::File&);
+        
+        //==============================================================================================================
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LogSinkMapped)
+    };
+}
+#endif
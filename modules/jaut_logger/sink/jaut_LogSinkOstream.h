@@ -109,7 +109,12 @@ namespace jaut
         
         JAUT_NODISCARD
         const ILogFormat *getFormatter() const override;
-    
+        
+        #if JAUT_LOGGER_METRICS
+        JAUT_NODISCARD
+        const LogSinkMetrics *getMetrics() const noexcept override;
+        #endif
+        
     private:
         using LockGuard = typename CriticalSection::ScopedLockType;
         
@@ -117,6 +122,11 @@ namespace jaut
         mutable CriticalSection lock;
         std::ostream &ostream;
         std::unique_ptr<ILogFormat> formatter;
+        fmt::memory_buffer buffer;
+        
+        #if JAUT_LOGGER_METRICS
+        LogSinkMetrics metrics;
+        #endif
         
         //==============================================================================================================
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LogSinkOstream)
@@ -169,7 +179,19 @@ namespace jaut
         
         if (formatter)
         {
-            ostream << formatter->format(parMessage);
+            buffer.clear();
+            
+            #if JAUT_LOGGER_METRICS
+            const detail::MetricsStopwatch format_stopwatch;
+            #endif
+            
+            formatter->formatTo(buffer, parMessage);
+            
+            #if JAUT_LOGGER_METRICS
+            metrics.recordFormat(format_stopwatch.getElapsed());
+            #endif
+            
+            ostream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
         }
         else
         {
@@ -181,6 +203,11 @@ namespace jaut
     inline void LogSinkOstream<CS>::flush()
     {
         jdscoped LockGuard(lock);
+        
+        #if JAUT_LOGGER_METRICS
+        const detail::ScopedMetricsTimer write_timer(metrics.writeTime);
+        #endif
+        
         ostream << std::flush;
     }
     
@@ -227,6 +254,14 @@ namespace jaut
     {
         return formatter.get();
     }
+    
+    #if JAUT_LOGGER_METRICS
+    template<class CS>
+    inline const LogSinkMetrics* LogSinkOstream<CS>::getMetrics() const noexcept
+    {
+        return &metrics;
+    }
+    #endif
 }
 //======================================================================================================================
 // region Implementation (LogSinkOstream)
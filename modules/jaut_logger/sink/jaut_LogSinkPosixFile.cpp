@@ -0,0 +1,401 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogSinkPosixFile.cpp
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+
+#pragma once
+
+#include <jaut_logger/sink/jaut_LogSinkPosixFile.h>
+
+#if JUCE_LINUX || JUCE_BSD || JUCE_MAC || JUCE_IOS || JUCE_ANDROID
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+
+
+//**********************************************************************************************************************
+// region Namespace
+//======================================================================================================================
+namespace
+{
+    juce::String getErrorString()
+    {
+        return juce::String(std::strerror(errno));
+    }
+}
+//======================================================================================================================
+// endregion Namespace
+//**********************************************************************************************************************
+// region LogSinkPosixFile
+//======================================================================================================================
+namespace jaut
+{
+    //==================================================================================================================
+    void LogSinkPosixFile::AlignedDeleter::operator()(char *parData) const noexcept
+    {
+        std::free(parData);
+    }
+    
+    //==================================================================================================================
+    LogSinkPosixFile::LogSinkPosixFile(juce::File parLogFile)
+        : LogSinkPosixFile(std::move(parLogFile), Options{})
+    {}
+    
+    LogSinkPosixFile::LogSinkPosixFile(juce::File parLogFile, Options parOptions)
+        : options(std::move(parOptions)),
+          logFile(std::move(parLogFile))
+    {
+        if (const juce::Result result = logFile.create();
+            result.failed())
+        {
+            throw LogIOException("could not create log file '" + logFile.getFullPathName() + "': "
+                                 + result.getErrorMessage());
+        }
+        
+        pending.reserve(static_cast<std::size_t>(std::max(options.bufferSize, 0)));
+        openFile();
+    }
+    
+    LogSinkPosixFile::~LogSinkPosixFile()
+    {
+        if (fd < 0)
+        {
+            return;
+        }
+        
+        try
+        {
+            writePending();
+        }
+        catch (const LogIOException&)
+        {
+            // There is nobody left that could handle this
+        }
+        
+        (void) ::close(fd);
+    }
+    
+    //==================================================================================================================
+    void LogSinkPosixFile::print(const LogMessage &parLogMessage)
+    {
+        const std::size_t previous_size = pending.size();
+        
+        #if JAUT_LOGGER_METRICS
+        const detail::MetricsStopwatch format_stopwatch;
+        #endif
+        
+        options.formatter->formatTo(pending, parLogMessage);
+        
+        #if JAUT_LOGGER_METRICS
+        metrics.recordFormat(format_stopwatch.getElapsed());
+        #endif
+        
+        numBytesFormatted += (pending.size() - previous_size);
+        ++numLinesFormatted;
+        
+        if (pending.size() >= static_cast<std::size_t>(options.bufferSize))
+        {
+            writePending();
+        }
+    }
+    
+    void LogSinkPosixFile::prepare(int parNumLines)
+    {
+        if (parNumLines <= 0)
+        {
+            return;
+        }
+        
+        // Estimate the size of the batch by the average size of the events we have seen so far
+        const std::uint64_t average_size = (numLinesFormatted > 0 ? (numBytesFormatted / numLinesFormatted) : 128);
+        const std::uint64_t batch_size   = std::min(average_size * static_cast<std::uint64_t>(parNumLines),
+                                                    static_cast<std::uint64_t>(std::max(options.bufferSize, 0)));
+        
+        pending.reserve(pending.size() + static_cast<std::size_t>(batch_size));
+    }
+    
+    void LogSinkPosixFile::flush()
+    {
+        writePending();
+        
+        if (options.syncInterval <= 0 || ++numFlushes < options.syncInterval)
+        {
+            return;
+        }
+        
+        numFlushes = 0;
+        
+        #if JUCE_MAC || JUCE_IOS
+        const int result = ::fsync(fd);
+        #else
+        const int result = ::fdatasync(fd);
+        #endif
+        
+        if (result != 0)
+        {
+            throw LogIOException("could not synchronise log file '" + logFile.getFullPathName() + "': "
+                                 + ::getErrorString());
+        }
+    }
+    
+    //==================================================================================================================
+    void LogSinkPosixFile::onOpen()
+    {
+        ILogFormat::Util::printHeader(getFormatter(), [this](const juce::String &header)
+        {
+            appendString(header);
+            pending.push_back('\n');
+            writePending();
+        });
+    }
+    
+    void LogSinkPosixFile::onClose()
+    {
+        ILogFormat::Util::printFooter(getFormatter(), [this](const juce::String &footer)
+        {
+            appendString(footer);
+            pending.push_back('\n');
+        });
+        
+        flush();
+    }
+    
+    //==================================================================================================================
+    const juce::File& LogSinkPosixFile::getLogFile() const noexcept
+    {
+        return logFile;
+    }
+    
+    const LogSinkPosixFile::Options& LogSinkPosixFile::getOptions() const noexcept
+    {
+        return options;
+    }
+    
+    bool LogSinkPosixFile::isDirectIo() const noexcept
+    {
+        return directIo;
+    }
+    
+    const ILogFormat* LogSinkPosixFile::getFormatter() const
+    {
+        return options.formatter.get().get();
+    }
+    
+    #if JAUT_LOGGER_METRICS
+    const LogSinkMetrics* LogSinkPosixFile::getMetrics() const noexcept
+    {
+        return &metrics;
+    }
+    #endif
+    
+    //==================================================================================================================
+    void LogSinkPosixFile::openFile()
+    {
+        const std::string path = logFile.getFullPathName().toStdString();
+        
+        #ifdef O_DIRECT
+        if (options.directIo)
+        {
+            fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC | O_DIRECT, 0644);
+            
+            // If the file system doesn't like O_DIRECT, we will just fall through to the normal way
+            if (fd >= 0)
+            {
+                struct stat file_stat {};
+                
+                if (::fstat(fd, &file_stat) != 0)
+                {
+                    throw LogIOException("could not read log file '" + logFile.getFullPathName() + "': "
+                                         + ::getErrorString());
+                }
+                
+                directIo = true;
+                fileSize = static_cast<std::uint64_t>(file_stat.st_size);
+                
+                // The last incomplete block will be rewritten with the next flush, so we need to know what's in it
+                if (const std::size_t tail_size = (fileSize % directIoAlignment); tail_size > 0)
+                {
+                    directTail.resize(tail_size);
+                    
+                    const int  read_fd    = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+                    const bool tail_valid = (read_fd >= 0 && ::pread(read_fd, directTail.data(), tail_size,
+                                                                     static_cast<off_t>(fileSize - tail_size))
+                                                                 == static_cast<ssize_t>(tail_size));
+                    
+                    if (read_fd >= 0)
+                    {
+                        (void) ::close(read_fd);
+                    }
+                    
+                    if (!tail_valid)
+                    {
+                        throw LogIOException("could not read log file '" + logFile.getFullPathName() + "': "
+                                             + ::getErrorString());
+                    }
+                }
+                
+                return;
+            }
+        }
+        #endif
+        
+        fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC | O_APPEND, 0644);
+        
+        if (fd < 0)
+        {
+            throw LogIOException("could not open log file '" + logFile.getFullPathName() + "': " + ::getErrorString());
+        }
+    }
+    
+    void LogSinkPosixFile::writePending()
+    {
+        if (pending.size() == 0)
+        {
+            return;
+        }
+        
+        #if JAUT_LOGGER_METRICS
+        const detail::ScopedMetricsTimer write_timer(metrics.writeTime);
+        #endif
+        
+        if (directIo)
+        {
+            writeDirect();
+            return;
+        }
+        
+        const char  *data      = pending.data();
+        std::size_t remaining = pending.size();
+        
+        while (remaining > 0)
+        {
+            const ssize_t written = ::write(fd, data, remaining);
+            
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                
+                pending.clear();
+                throw LogIOException("could not write to log file '" + logFile.getFullPathName() + "': "
+                                     + ::getErrorString());
+            }
+            
+            data      += written;
+            remaining -= static_cast<std::size_t>(written);
+        }
+        
+        pending.clear();
+    }
+    
+    void LogSinkPosixFile::writeDirect()
+    {
+        const std::size_t total_size   = (directTail.size() + pending.size());
+        const std::size_t aligned_size = ((total_size + directIoAlignment - 1) / directIoAlignment) * directIoAlignment;
+        
+        if (directBufferSize < aligned_size)
+        {
+            void *memory = nullptr;
+            
+            if (::posix_memalign(&memory, directIoAlignment, aligned_size) != 0)
+            {
+                pending.clear();
+                throw LogIOException("could not allocate the write buffer for log file '"
+                                     + logFile.getFullPathName() + "'");
+            }
+            
+            directBuffer.reset(static_cast<char*>(memory));
+            directBufferSize = aligned_size;
+        }
+        
+        char *const buffer = directBuffer.get();
+        std::memcpy(buffer,                     directTail.data(), directTail.size());
+        std::memcpy(buffer + directTail.size(), pending.data(),    pending.size());
+        std::memset(buffer + total_size, 0, (aligned_size - total_size));
+        
+        const std::uint64_t new_size = (fileSize + pending.size());
+        pending.clear();
+        
+        const char  *data      = buffer;
+        std::size_t remaining = aligned_size;
+        auto        offset    = static_cast<off_t>(fileSize - directTail.size());
+        
+        while (remaining > 0)
+        {
+            const ssize_t written = ::pwrite(fd, data, remaining, offset);
+            
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                
+                throw LogIOException("could not write to log file '" + logFile.getFullPathName() + "': "
+                                     + ::getErrorString());
+            }
+            
+            data      += written;
+            offset    += written;
+            remaining -= static_cast<std::size_t>(written);
+        }
+        
+        // Cut off the padding of the last block again, it will be overwritten by the next flush
+        if (::ftruncate(fd, static_cast<off_t>(new_size)) != 0)
+        {
+            throw LogIOException("could not write to log file '" + logFile.getFullPathName() + "': "
+                                 + ::getErrorString());
+        }
+        
+        const std::size_t tail_size = (new_size % directIoAlignment);
+        directTail.assign(buffer + total_size - tail_size, tail_size);
+        fileSize = new_size;
+    }
+    
+    void LogSinkPosixFile::appendString(const juce::String &parText)
+    {
+        const char *const data = parText.toRawUTF8();
+        pending.append(data, data + parText.getNumBytesAsUTF8());
+    }
+}
+//======================================================================================================================
+// endregion LogSinkPosixFile
+//**********************************************************************************************************************
+#endif
@@ -0,0 +1,201 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogSinkPosixFile.h
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+
+#pragma once
+
+#include <jaut_logger/exception/jaut_LogIOException.h>
+#include <jaut_logger/format/jaut_LogFormatPattern.h>
+#include <jaut_logger/sink/jaut_ILogSink.h>
+
+#include <jaut_core/define/jaut_Define.h>
+
+#include <juce_core/juce_core.h>
+
+
+
+#if JUCE_LINUX || JUCE_BSD || JUCE_MAC || JUCE_IOS || JUCE_ANDROID
+namespace jaut
+{
+    /**
+     *  A Logger output sink for log files that talks to the file descriptor directly, for POSIX systems only.<br>
+     *  All events are formatted into one contiguous buffer that is written to the file with a single system call
+     *  whenever the sink is flushed, so a whole batch of events costs only one write.
+     *  <br><br>
+     *  Optionally, this sink can synchronise the file with the disk every few flushes and can bypass the page cache
+     *  with O_DIRECT, where supported.
+     *  <br><br>
+     *  This sink does not support replacing formatters.
+     */
+    class JAUT_API LogSinkPosixFile : public ILogSink
+    {
+    public:
+        static constexpr int  default_bufferSize   = 65536;
+        static constexpr int  default_syncInterval = 0;
+        static constexpr bool default_directIo     = false;
+        
+        //==============================================================================================================
+        struct Options
+        {
+            /**
+             *  The formatter to be used by this sink.
+             *  @see jaut::LogFormat
+             */
+            NonNull<std::unique_ptr<ILogFormat>> formatter = std::make_unique<DefaultFormatterType>();
+            
+            /**
+             *  The amount of bytes that may be pending before the sink writes them to the file on its own,
+             *  even if no flush was requested. (in bytes)
+             */
+            int bufferSize = default_bufferSize;
+            
+            /**
+             *  Determines after how many flushes the file's data should be synchronised with the disk.<br>
+             *  A value of 1 will synchronise on every flush, a value of 0 will leave it to the operating system.
+             */
+            int syncInterval = default_syncInterval;
+            
+            /**
+             *  Determines whether the file should be opened with O_DIRECT, bypassing the page cache.
+             *  <br><br>
+             *  Since O_DIRECT needs block aligned writes, the last incomplete block of the file will be rewritten on
+             *  the next flush.<br>
+             *  This only has an effect on systems that support O_DIRECT, if the file system doesn't support it,
+             *  this sink will fall back to regular writes.
+             */
+            bool directIo = default_directIo;
+        };
+        
+        //==============================================================================================================
+        /**
+         *  Creates a new POSIX file logging sink.
+         *  @param logFile The file to log to
+         *  
+         *  @throw jaut::LogIOException If the file could not be opened
+         */
+        explicit LogSinkPosixFile(juce::File logFile);
+        
+        /**
+         *  Creates a new POSIX file logging sink.
+         *  
+         *  @param logFile The file to log to
+         *  @param options The options for this file sink
+         *  
+         *  @throw jaut::LogIOException If the file could not be opened
+         */
+        LogSinkPosixFile(juce::File logFile, Options options);
+        
+        ~LogSinkPosixFile() override;
+        
+        //==============================================================================================================
+        void print(const LogMessage &logMessage) override;
+        void prepare(int numLines)               override;
+        void flush()                             override;
+        
+        //==============================================================================================================
+        void onOpen()  override;
+        void onClose() override;
+        
+        //==============================================================================================================
+        /**
+         *  Gets the file that has been set to be the log file.
+         *  @return The current log file
+         */
+        JAUT_NODISCARD
+        const juce::File& getLogFile() const noexcept;
+        
+        /**
+         *  Gets the options of this file sink.
+         *  @return The options
+         */
+        JAUT_NODISCARD
+        const Options& getOptions() const noexcept;
+        
+        /**
+         *  Gets whether the file was opened with O_DIRECT.
+         *  @return True if the page cache is being bypassed
+         */
+        JAUT_NODISCARD
+        bool isDirectIo() const noexcept;
+        
+        JAUT_NODISCARD
+        const ILogFormat* getFormatter() const override;
+        
+        #if JAUT_LOGGER_METRICS
+        JAUT_NODISCARD
+        const LogSinkMetrics* getMetrics() const noexcept override;
+        #endif
+        
+    private:
+        struct AlignedDeleter
+        {
+            void operator()(char *data) const noexcept;
+        };
+        
+        using AlignedBuffer = std::unique_ptr<char, AlignedDeleter>;
+        
+        //==============================================================================================================
+        static constexpr std::size_t directIoAlignment = 4096;
+        
+        //==============================================================================================================
+        Options            options;
+        juce::File         logFile;
+        fmt::memory_buffer pending;
+        
+        AlignedBuffer directBuffer;
+        std::size_t   directBufferSize { 0 };
+        std::string   directTail;
+        
+        std::uint64_t numBytesFormatted { 0 };
+        std::uint64_t numLinesFormatted { 0 };
+        std::uint64_t fileSize          { 0 };
+        int           numFlushes        { 0 };
+        int           fd                { -1 };
+        bool          directIo          { false };
+        
+        #if JAUT_LOGGER_METRICS
+        LogSinkMetrics metrics;
+        #endif
+        
+        //==============================================================================================================
+        void openFile();
+        void writePending();
+        void writeDirect();
+        void appendString(const juce::String &text);
+        
+        //==============================================================================================================
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LogSinkPosixFile)
+    };
+}
+#endif
@@ -51,7 +51,8 @@ namespace jaut
     {}
     
     LogSinkRotatingFile::LogSinkRotatingFile(juce::File parLogFile, Options parOptions)
-        : rotationManager(parLogFile, parOptions.rotationPolicy, parOptions.rotationStrategy),
+        : rotationManager(parLogFile, parOptions.rotationPolicy, parOptions.rotationStrategy,
+                          LogRotationManager::Options{ parOptions.asyncRotation }),
           options        (std::move(parOptions)),
           logFile        (std::move(parLogFile))
     {
@@ -72,7 +73,7 @@ namespace jaut
         stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
         
         rotationManager.eventBeforeRotation += jaut::makeHandler(&LogSinkRotatingFile::closeOnRotation, this);
-        rotationManager.eventAfterRotation  += jaut::makeHandler(&LogSinkRotatingFile::openOnRotation,  this);
+        rotationManager.eventLogRenewed     += jaut::makeHandler(&LogSinkRotatingFile::openOnRotation,  this);
         rotationManager.eventAfterRotation  += jaut::makeHandler(eventLogRotated);
         
         if (options.buffered)
@@ -93,6 +94,9 @@ namespace jaut
         {
             throw LogIOException(ex.what());
         }
+        
+        // From here on, the size of the log is tracked by what we write
+        rotationManager.refreshLogSize();
     }
     
     LogSinkRotatingFile::~LogSinkRotatingFile() = default;
@@ -105,39 +109,57 @@ namespace jaut
             throw LogIOException("stream could not be opened");
         }
         
-        ILogFormat         &formatter        = *options.formatter;
-        const juce::String message_formatted = formatter.format(parLogMessage);
-        bool               has_rotated       = false;
+        const bool replacing = (!options.append && options.formatter->supportsReplacingFormatter());
+        renderMessage(parLogMessage, replacing);
+        
+        bool has_rotated = false;
         
-        if (options.append || (formatter.supportsReplacingFormatter() && !content.isEmpty()))
+        if (options.append || (replacing && !content.isEmpty()))
         {
-            has_rotated = rotationManager.tryRotateLogs(parLogMessage, message_formatted);
+            std::size_t message_size = buffer.size();
+            
+            if (replacing)
+            {
+                // The rendered output replaces the entire log, so the policy only gets what it adds to it
+                const std::uint64_t log_size = rotationManager.getLogSize();
+                message_size = (buffer.size() > log_size ? static_cast<std::size_t>(buffer.size() - log_size) : 0);
+            }
+            
+            has_rotated = rotationManager.tryRotateLogs(parLogMessage, message_size);
             
             if (has_rotated)
             {
                 content = "";
+                
+                // The output was based on the log that has just been rotated, so it needs to start over,
+                // this also goes for formatters that keep state per log, which was reset by the new log's header
+                renderMessage(parLogMessage, replacing);
             }
         }
         
-        if (!options.append)
+        if (!options.append && !has_rotated)
         {
-            if (!has_rotated)
-            {
-                clearContents();
-            }
-            
-            if (formatter.supportsReplacingFormatter())
-            {
-                stream << (content = formatter.formatReplace(parLogMessage, content));
-                return;
-            }
+            clearContents();
+        }
+        
+        stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        
+        if (replacing)
+        {
+            content = juce::String::fromUTF8(buffer.data(), static_cast<int>(buffer.size()));
+            rotationManager.reportLogSize(buffer.size());
+            return;
         }
         
-        stream << message_formatted;
+        rotationManager.reportWritten(buffer.size());
     }
     
     void LogSinkRotatingFile::flush()
     {
+        #if JAUT_LOGGER_METRICS
+        const detail::ScopedMetricsTimer write_timer(metrics.writeTime);
+        #endif
+        
         if (stream.is_open())
         {
             stream << std::flush;
@@ -152,9 +174,10 @@ namespace jaut
             return;
         }
         
-        ILogFormat::Util::printHeader(getFormatter(), [&out = stream](const juce::String &header)
+        ILogFormat::Util::printHeader(getFormatter(), [this](const juce::String &header)
         {
-            out << header << std::endl;
+            stream << header << std::endl;
+            rotationManager.reportWritten(header.getNumBytesAsUTF8() + 1);
         });
     }
     
@@ -165,9 +188,10 @@ namespace jaut
             return;
         }
         
-        ILogFormat::Util::printFooter(getFormatter(), [&out = stream](const juce::String &footer)
+        ILogFormat::Util::printFooter(getFormatter(), [this](const juce::String &footer)
         {
-            out << footer << std::endl;
+            stream << footer << std::endl;
+            rotationManager.reportWritten(footer.getNumBytesAsUTF8() + 1);
         });
     }
     
@@ -187,6 +211,13 @@ namespace jaut
         return options.formatter.get().get();
     }
     
+    #if JAUT_LOGGER_METRICS
+    const LogSinkMetrics* LogSinkRotatingFile::getMetrics() const noexcept
+    {
+        return &metrics;
+    }
+    #endif
+    
     //==================================================================================================================
     void LogSinkRotatingFile::closeOnRotation(const juce::File&)
     {
@@ -231,12 +262,35 @@ namespace jaut
             }
             
             stream.open(logFile.getFullPathName().toStdString(), std::ios::binary | std::ios::trunc);
+            rotationManager.reportLogSize(0);
         }
         catch (const std::exception &ex)
         {
             throw LogIOException(ex.what());
         }
     }
+    
+    void LogSinkRotatingFile::renderMessage(const LogMessage &parLogMessage, bool parReplacing)
+    {
+        buffer.clear();
+        
+        #if JAUT_LOGGER_METRICS
+        const detail::MetricsStopwatch format_stopwatch;
+        #endif
+        
+        if (parReplacing)
+        {
+            options.formatter->formatReplaceTo(buffer, parLogMessage, content);
+        }
+        else
+        {
+            options.formatter->formatTo(buffer, parLogMessage);
+        }
+        
+        #if JAUT_LOGGER_METRICS
+        metrics.recordFormat(format_stopwatch.getElapsed());
+        #endif
+    }
 }
 //======================================================================================================================
 // endregion LogSinkRotatingFile
@@ -71,6 +71,7 @@ namespace jaut
         static constexpr bool default_buffered = true;
         static constexpr int  default_bufferSize = 4096;
         static constexpr bool default_append = true;
+        static constexpr bool default_asyncRotation = LogRotationManager::default_async;
         
         //==============================================================================================================
         struct Options
@@ -108,6 +109,16 @@ namespace jaut
              *  If supported and enabled, this will enable the replacing version of the formatter.
              */
             bool append = default_append;
+            
+            /**
+             *  Whether rotated logs should be archived on a background thread.<br>
+             *  If this is true, rotating will only rename the log file on the logging thread and leave compressing
+             *  and shifting archives to the rotation thread, in which case eventLogRotated will be raised on the
+             *  rotation thread.
+             *  
+             *  @see jaut::LogRotationManager::Options::async
+             */
+            bool asyncRotation = default_asyncRotation;
         };
         
         //==============================================================================================================
@@ -117,7 +128,8 @@ namespace jaut
         /**
          *  This event will be raised whenever the log file was rotated.<br>
          *  Note that, while adding events is thread-safe, the event being raised is not necessarily, as
-         *  this will always be raised on the thread the log messages are processed on.
+         *  this will always be raised on the thread the log messages are processed on,
+         *  or on the rotation thread if Options::asyncRotation is enabled.
          *  <br><br>
          *  If Options::logRotationOptions::fileManagementBehaviour is set to
          *  LogRotationManager::FileManagementBehaviour::Delete, the event's parameter is an invalid file.
@@ -173,15 +185,25 @@ namespace jaut
         JAUT_NODISCARD
         const ILogFormat* getFormatter() const override;
         
+        #if JAUT_LOGGER_METRICS
+        JAUT_NODISCARD
+        const LogSinkMetrics* getMetrics() const noexcept override;
+        #endif
+        
     private:
         LogRotationManager rotationManager;
         
         std::vector<char> streamBuf;
         
-        std::ofstream stream;
-        Options       options;
-        juce::File    logFile;
-        juce::String  content;
+        std::ofstream      stream;
+        Options            options;
+        juce::File         logFile;
+        juce::String       content;
+        fmt::memory_buffer buffer;
+        
+        #if JAUT_LOGGER_METRICS
+        LogSinkMetrics metrics;
+        #endif
         
         //==============================================================================================================
         void closeOnRotation(const juce::File&);
@@ -189,6 +211,7 @@ namespace jaut
         
         //==============================================================================================================
         void clearContents();
+        void renderMessage(const LogMessage &logMessage, bool replacing);
         
         //==============================================================================================================
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LogSinkRotatingFile)
@@ -35,6 +35,7 @@
 #pragma once
 
 #include <jaut_logger/jaut_LogMessage.h>
+#include <jaut_logger/jaut_LogMetrics.h>
 #include <jaut_logger/jaut_FlushPolicy.h>
 
 #include <jaut_core/define/jaut_Define.h>
@@ -104,6 +105,20 @@ namespace jaut
          */
         virtual bool enqueue(LogMessage message) = 0;
         
+        /**
+         *  Enqueues a message into the log buffer, discarding the oldest message in the buffer if it is full.<br>
+         *  This is used by OverflowPolicy::DropOldest and is only supported by workers that can safely consume from
+         *  the producer site, the default implementation does nothing and returns false.
+         *  
+         *  @param message The message to enqueue
+         *  @return True if the message was enqueued, false if this worker doesn't support replacing messages
+         */
+        virtual bool enqueueReplacingOldest(LogMessage message)
+        {
+            jaut::ignore(message);
+            return false;
+        }
+        
         //==============================================================================================================
         /** 
          *  Whether the log buffer is empty.
@@ -148,5 +163,16 @@ namespace jaut
          *  @return The flush result
          */
         virtual FlushAttemptResult tryFlush(const LogMessage &lastMessage) = 0;
+        
+        //==============================================================================================================
+        /**
+         *  Gets the figures this worker collected about its buffer.<br>
+         *  These are only collected if JAUT_LOGGER_METRICS is enabled, the returned object may be read from any
+         *  thread at any time.
+         *  
+         *  @return The worker's metrics or nullptr if it doesn't collect any
+         */
+        JAUT_NODISCARD
+        virtual const LogWorkerMetrics* getMetrics() const noexcept { return nullptr; }
     };
 }
@@ -0,0 +1,134 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogRunMerger.h
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+#pragma once
+
+#include <jaut_core/define/jaut_Define.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+
+
+namespace jaut
+{
+    //==================================================================================================================
+    /**
+     *  Merges several runs of messages, which are each already in order, into one run that is in order as a whole.
+     *  <br><br>
+     *  This is meant for workers that collect messages in more than one lane, for example one per producer thread,
+     *  where every lane is in order by itself.
+     *  Instead of sorting all messages again, which is O(n log n), the heads of all runs are kept in a binary heap,
+     *  which makes merging O(n log k) for k runs.
+     *  Messages that compare equal are taken from the run that comes first, so merging is stable.
+     *  <br><br>
+     *  The heap storage is kept between merges, so a merger that is reused doesn't allocate after the first few
+     *  merges.
+     */
+    class JAUT_API LogRunMerger
+    {
+    public:
+        /**
+         *  Merges the given runs into the output, the merged elements will be moved from.
+         *  
+         *  @param runs   A random access range of random access ranges, each of them in order by less
+         *  @param output The output iterator to write the merged elements to
+         *  @param less   The function that determines the order of two elements
+         */
+        template<class Runs, class OutputIt, class Less>
+        void merge(Runs &runs, OutputIt output, Less less);
+        
+    private:
+        struct Head
+        {
+            std::size_t run;
+            std::size_t index;
+        };
+        
+        //==============================================================================================================
+        std::vector<Head> heads;
+    };
+    
+    //==================================================================================================================
+    // IMPLEMENTATION LogRunMerger
+    template<class Runs, class OutputIt, class Less>
+    inline void LogRunMerger::merge(Runs &parRuns, OutputIt parOutput, Less parLess)
+    {
+        heads.clear();
+        
+        for (std::size_t i = 0; i < std::size(parRuns); ++i)
+        {
+            if (!std::empty(parRuns[i]))
+            {
+                heads.push_back({ i, 0 });
+            }
+        }
+        
+        // The standard heap is a max-heap, so this has to say which head should come later
+        const auto comes_later = [&parRuns, &parLess](const Head &left, const Head &right)
+        {
+            const auto &left_value  = parRuns[left .run][left .index];
+            const auto &right_value = parRuns[right.run][right.index];
+            
+            if (parLess(right_value, left_value))
+            {
+                return true;
+            }
+            
+            return (!parLess(left_value, right_value) && left.run > right.run);
+        };
+        
+        std::make_heap(heads.begin(), heads.end(), comes_later);
+        
+        while (!heads.empty())
+        {
+            std::pop_heap(heads.begin(), heads.end(), comes_later);
+            Head &head = heads.back();
+            
+            *parOutput = std::move(parRuns[head.run][head.index]);
+            ++parOutput;
+            
+            if (++head.index < std::size(parRuns[head.run]))
+            {
+                std::push_heap(heads.begin(), heads.end(), comes_later);
+            }
+            else
+            {
+                heads.pop_back();
+            }
+        }
+    }
+}
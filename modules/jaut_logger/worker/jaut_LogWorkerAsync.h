@@ -38,10 +38,12 @@
 #include <jaut_logger/jaut_LogLevel.h>
 #include <jaut_logger/sink/jaut_ILogSink.h>
 #include <jaut_logger/worker/jaut_ILogWorker.h>
+#include <jaut_logger/worker/jaut_LogWorkerThreaded.h>
 
 #include <jaut_core/define/jaut_Define.h>
 
 #include <jaut_message/thread/buffer/jaut_AtomicRingBuffer.h>
+#include <jaut_message/thread/buffer/jaut_MpscRingBuffer.h>
 
 #include <juce_core/juce_core.h>
 
@@ -59,19 +61,28 @@ namespace jaut
      *  several threads simultaneously.<br>
      *  However, this is disabled by default, assuming the logger will log only on one thread.<br>
      *  The consumer side is entirely lock-free as long as the implementation allows atomic ints to be lock-free.
+     *  <br><br>
+     *  If the buffer supports multiple producers, like jaut::MpscRingBuffer, the lock will not be used at all
+     *  and logging from several threads will be entirely lock-free.
+     *  <br><br>
+     *  The worker-thread does not poll, it sleeps until a flush has been requested or the next timed flush is due.
+     *  <br><br>
+     *  Messages are printed in the order they were enqueued, which the buffer already guarantees, so batches don't
+     *  need to be sorted.
+     *  The batch they are popped into is reused for every flush.
      *  
-     *  @tparam BufferSize The size of the message queue
+     *  @tparam BufferSize      The size of the message queue
+     *  @tparam CriticalSection A lock that allows multiple threads to log messages
+     *  @tparam Buffer          The message buffer template to use
      */
-    template<int BufferSize = 512, class CriticalSection = juce::DummyCriticalSection>
-    class JAUT_API LogWorkerAsync : public ILogWorker, private juce::Thread
+    template<int BufferSize = 512,
+             class CriticalSection = juce::DummyCriticalSection,
+             template<int, class> class Buffer = AtomicRingBuffer>
+    class JAUT_API LogWorkerAsync : public LogWorkerThreaded
     {
     public:
         LogWorkerAsync();
         
-        //==============================================================================================================
-        void setup(AbstractLogger &logger, const FlushPolicy::Settings &flushPolicy) override;
-        void finalise() override;
-        
         //==============================================================================================================
         bool enqueue(LogMessage message) override;
         
@@ -82,27 +93,29 @@ namespace jaut
         JAUT_NODISCARD int  capacity() const override;
         
         //==============================================================================================================
-        bool               flush()                                 override;
-        FlushAttemptResult tryFlush(const LogMessage &lastMessage) override;
+        #if JAUT_LOGGER_METRICS
+        JAUT_NODISCARD
+        const LogWorkerMetrics* getMetrics() const noexcept override;
+        #endif
         
     private:
-        using Clock     = std::chrono::steady_clock;
-        using TimePoint = std::chrono::time_point<Clock>;
-        using Guard     = typename CriticalSection::ScopedLockType;
+        using BufferType   = Buffer<BufferSize, LogMessage>;
+        using ProducerLock = std::conditional_t<isMultiProducerBuffer_v<BufferType>, juce::DummyCriticalSection,
+                                                CriticalSection>;
+        using Guard        = typename ProducerLock::ScopedLockType;
         
         //==============================================================================================================
-        CriticalSection lock;
+        ProducerLock lock;
         
-        FlushPolicy::Settings                    flushBehaviour;
-        AtomicRingBuffer<BufferSize, LogMessage> buffer;
-        TimePoint                                lastTime;
-        AbstractLogger                           *logger { nullptr };
+        BufferType              buffer;
+        std::vector<LogMessage> batch;
         
-        std::atomic<bool> dirty   { false };
-        std::atomic<bool> running {  true };
+        #if JAUT_LOGGER_METRICS
+        LogWorkerMetrics metrics;
+        #endif
         
         //==============================================================================================================
-        void run() override;
+        void processBuffer() override;
     
         //==============================================================================================================
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LogWorkerAsync)
@@ -110,186 +123,97 @@ namespace jaut
     
     //==================================================================================================================
     // IMPLEMENTATION
-    template<int N, class L>
-    inline LogWorkerAsync<N, L>::LogWorkerAsync()
-        : juce::Thread("Logger")
-    {}
-    
-    //==================================================================================================================
-    template<int N, class L>
-    inline void LogWorkerAsync<N, L>::setup(AbstractLogger &parLogger, const FlushPolicy::Settings &parFlushPolicy)
-    {
-        logger = &parLogger;
-        
-        using std::swap;
-        FlushPolicy::Settings temp_policy(parFlushPolicy);
-        swap(flushBehaviour, temp_policy);
-        
-        for (const AbstractLogger::SinkPtr &sink_ptr : parLogger.getSinks())
-        {
-            sink_ptr->onOpen();
-        }
-        
-        lastTime = Clock::now();
-        
-        startThread();
-    }
-    
-    template<int N, class L>
-    void LogWorkerAsync<N, L>::finalise()
+    template<int N, class L, template<int, class> class B>
+    inline LogWorkerAsync<N, L, B>::LogWorkerAsync()
     {
-        if (flushBehaviour.flushOnFinalisation)
-        {
-            dirty = true;
-            while (!isEmpty());
-            
-            running = false;
-            stopThread(5000);
-        }
+        batch.reserve(static_cast<std::size_t>(N));
     }
     
     //==================================================================================================================
-    template<int N, class L>
-    inline bool LogWorkerAsync<N, L>::enqueue(LogMessage parMessage)
+    template<int N, class L, template<int, class> class B>
+    inline bool LogWorkerAsync<N, L, B>::enqueue(LogMessage parMessage)
     {
+        #if JAUT_LOGGER_METRICS
+        const detail::MetricsStopwatch stopwatch;
+        #endif
+        
         jdscoped Guard(lock);
         
         const int result = buffer.push(std::move(parMessage));
+        
+        #if JAUT_LOGGER_METRICS
+        metrics.recordPush(stopwatch.getElapsed(), result);
+        #endif
+        
         return (result > -1);
     }
     
     //==================================================================================================================
-    template<int N, class L>
-    inline bool LogWorkerAsync<N, L>::isEmpty() const
+    template<int N, class L, template<int, class> class B>
+    inline bool LogWorkerAsync<N, L, B>::isEmpty() const
     {
         jdscoped Guard(lock);
         return buffer.isEmpty();
     }
     
-    template<int N, class L>
-    inline bool LogWorkerAsync<N, L>::isFull() const
+    template<int N, class L, template<int, class> class B>
+    inline bool LogWorkerAsync<N, L, B>::isFull() const
     {
         jdscoped Guard(lock);
         return buffer.isFull();
     }
     
-    template<int N, class L>
-    inline int LogWorkerAsync<N, L>::size() const
+    template<int N, class L, template<int, class> class B>
+    inline int LogWorkerAsync<N, L, B>::size() const
     {
         jdscoped Guard(lock);
         return buffer.size();
     }
     
-    template<int N, class L>
-    inline int LogWorkerAsync<N, L>::capacity() const
+    template<int N, class L, template<int, class> class B>
+    inline int LogWorkerAsync<N, L, B>::capacity() const
     {
         jdscoped Guard(lock);
         return buffer.capacity();
     }
     
     //==================================================================================================================
-    template<int N, class L>
-    inline bool LogWorkerAsync<N, L>::flush()
+    #if JAUT_LOGGER_METRICS
+    template<int N, class L, template<int, class> class B>
+    inline const LogWorkerMetrics* LogWorkerAsync<N, L, B>::getMetrics() const noexcept
     {
-        if (!logger)
-        {
-            return false;
-        }
-        
-        dirty = true;
-        return true;
+        return &metrics;
     }
+    #endif
     
-    template<int N, class L>
-    inline ILogWorker::FlushAttemptResult LogWorkerAsync<N, L>::tryFlush(const LogMessage &parLastMessage)
+    //==================================================================================================================
+    template<int N, class L, template<int, class> class B>
+    inline void LogWorkerAsync<N, L, B>::processBuffer()
     {
-        if (!logger)
-        {
-            return ILogWorker::FlushAttemptResult::NotReady;
-        }
+        batch.clear();
         
-        if (dirty)
+        if (buffer.popBatch(std::back_inserter(batch), buffer.capacity()) == 0)
         {
-            return ILogWorker::FlushAttemptResult::Async;
+            return;
         }
         
-        if (    flushBehaviour.policies.test(FlushPolicy::Instant)
-            || (flushBehaviour.policies.test(FlushPolicy::Filled)   && isFull())
-            || (flushBehaviour.policies.test(FlushPolicy::Levelled) && parLastMessage.level >= flushBehaviour.level)
-            || (flushBehaviour.policies.test(FlushPolicy::Custom)   && flushBehaviour.customPolicy(parLastMessage)))
-        {
-            flush();
-            
-            if (!dirty)
-            {
-                return ILogWorker::FlushAttemptResult::Successful;
-            }
-        }
+        #if JAUT_LOGGER_METRICS
+        metrics.batchSize.record(batch.size());
+        #endif
         
-        return ILogWorker::FlushAttemptResult::Async;
-    }
-    
-    //==================================================================================================================
-    template<int N, class L>
-    inline void LogWorkerAsync<N, L>::run()
-    {
-        while (running)
+        for (const AbstractLogger::SinkPtr &sink_ptr : logger->getSinks())
         {
-            if (flushBehaviour.policies.test(FlushPolicy::Timed))
-            {
-                const TimePoint now = Clock::now();
-                const int elapsed = static_cast<int>(std::chrono::duration_cast<std::chrono::seconds>(now - lastTime)
-                                                                 .count());
-                
-                if (elapsed >= flushBehaviour.interval)
-                {
-                    dirty    = true;
-                    lastTime = Clock::now();
-                }
-            }
+            sink_ptr->prepare(static_cast<int>(batch.size()));
             
-            if (dirty.exchange(false))
+            for (LogMessage &message : batch)
             {
-                if (buffer.isEmpty())
-                {
-                    continue;
-                }
-                
-                std::vector<LogMessage> messages;
-                messages.reserve(buffer.size() + 10);
-                
-                while (!buffer.isEmpty())
-                {
-                    messages.emplace_back(buffer.pop());
-                }
-                
-                std::stable_sort(messages.begin(), messages.end(),
-                                 [](auto &&left, auto &&right) { return (left.timestamp < right.timestamp);});
-                
-                for (const AbstractLogger::SinkPtr &sink_ptr : logger->getSinks())
-                {
-                    sink_ptr->prepare(static_cast<int>(messages.size()));
-                    
-                    for (LogMessage &message : messages)
-                    {
-                        sink_ptr->print(message);
-                    }
-                    
-                    sink_ptr->flush();
-                }
+                sink_ptr->print(message);
             }
             
-            #if JAUT_PROVIDER_LOGGER_ASYNC_SLEEP > -1
-                // Cut some other threads some slack,
-                // the logger thread is not that important that it has to consume every cycle it gets
-                // we don't really care if the delay is a tad bit more than specified
-                sleep(JAUT_LOGGER_ASYNC_SLEEP);
-            #endif
+            sink_ptr->flush();
         }
         
-        for (const AbstractLogger::SinkPtr &sink_ptr : logger->getSinks())
-        {
-            sink_ptr->onClose();
-        }
+        // Keeps the capacity, but frees the messages right away instead of holding them until the next flush
+        batch.clear();
     }
 }
@@ -0,0 +1,266 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogWorkerDeferred.h
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+
+#pragma once
+
+#include <jaut_logger/jaut_logger_define.h>
+#include <jaut_logger/jaut_LogLevel.h>
+#include <jaut_logger/jaut_LogRecord.h>
+#include <jaut_logger/sink/jaut_ILogSink.h>
+#include <jaut_logger/worker/jaut_ILogWorker.h>
+#include <jaut_logger/worker/jaut_LogWorkerThreaded.h>
+
+#include <jaut_core/define/jaut_Define.h>
+
+#include <jaut_message/thread/buffer/jaut_MpscRingBuffer.h>
+
+#include <juce_core/juce_core.h>
+
+
+
+namespace jaut
+{
+    //==================================================================================================================
+    /**
+     *  The deferred log worker, an async worker that stores jaut::LogRecord objects instead of full messages.<br>
+     *  Like jaut::LogWorkerAsync, this will introduce a new thread to the logger that will handle consumption of
+     *  messages.
+     *  <br><br>
+     *  Records logged through AbstractLogger::logDeferred() are rendered into full messages on the worker-thread,
+     *  so the logging thread only has to copy a handful of bytes into the buffer.
+     *  Normal messages can still be logged, but they will be wrapped in a record, which requires an additional
+     *  allocation.
+     *  <br><br>
+     *  By default, this uses a jaut::MpscRingBuffer, so logging from several threads is entirely lock-free.
+     *  If a single-producer buffer is used instead, the CriticalSection will be locked on the producer site.
+     *  <br><br>
+     *  Either way, records are printed in the order they were enqueued, the buffers already guarantee that.
+     *  
+     *  @tparam BufferSize      The size of the record queue
+     *  @tparam CriticalSection A lock that allows multiple threads to log messages, if the buffer doesn't
+     *  @tparam Buffer          The record buffer template to use
+     */
+    template<int BufferSize = 512,
+             class CriticalSection = juce::DummyCriticalSection,
+             template<int, class> class Buffer = MpscRingBuffer>
+    class JAUT_API LogWorkerDeferred : public LogWorkerThreaded
+    {
+    public:
+        LogWorkerDeferred();
+        
+        //==============================================================================================================
+        bool enqueue(LogMessage message) override;
+        
+        /**
+         *  Enqueues a record into the log buffer if possible.
+         *  
+         *  @param record The record to enqueue
+         *  @return True if the record was enqueued, false if the buffer was full
+         */
+        bool enqueue(LogRecord record);
+        
+        //==============================================================================================================
+        JAUT_NODISCARD bool isEmpty()  const override;
+        JAUT_NODISCARD bool isFull()   const override;
+        JAUT_NODISCARD int  size()     const override;
+        JAUT_NODISCARD int  capacity() const override;
+        
+        //==============================================================================================================
+        using LogWorkerThreaded::tryFlush;
+        
+        /**
+         *  Tries to flush the buffer to all sinks if one of the given flushing policies was satisfied.
+         *  <br><br>
+         *  Do note that, if there is a custom flush policy, the record has to be rendered for it on the calling
+         *  thread, which defeats the purpose of deferring it.
+         *  
+         *  @param lastRecord The last record that was enqueued
+         *  @return The flush result
+         */
+        FlushAttemptResult tryFlush(const LogRecord &lastRecord);
+        
+        //==============================================================================================================
+        #if JAUT_LOGGER_METRICS
+        JAUT_NODISCARD
+        const LogWorkerMetrics* getMetrics() const noexcept override;
+        #endif
+        
+    private:
+        using BufferType   = Buffer<BufferSize, LogRecord>;
+        using ProducerLock = std::conditional_t<isMultiProducerBuffer_v<BufferType>, juce::DummyCriticalSection,
+                                                CriticalSection>;
+        using Guard        = typename ProducerLock::ScopedLockType;
+        
+        //==============================================================================================================
+        ProducerLock lock;
+        
+        BufferType              buffer;
+        std::vector<LogRecord>  records;
+        std::vector<LogMessage> messages;
+        
+        #if JAUT_LOGGER_METRICS
+        LogWorkerMetrics metrics;
+        #endif
+        
+        //==============================================================================================================
+        void processBuffer() override;
+        
+        //==============================================================================================================
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LogWorkerDeferred)
+    };
+    
+    //==================================================================================================================
+    // IMPLEMENTATION
+    template<int N, class L, template<int, class> class B>
+    inline LogWorkerDeferred<N, L, B>::LogWorkerDeferred()
+    {
+        records .reserve(static_cast<std::size_t>(N));
+        messages.reserve(static_cast<std::size_t>(N));
+    }
+    
+    //==================================================================================================================
+    template<int N, class L, template<int, class> class B>
+    inline bool LogWorkerDeferred<N, L, B>::enqueue(LogMessage parMessage)
+    {
+        return enqueue(LogRecord::fromMessage(std::move(parMessage)));
+    }
+    
+    template<int N, class L, template<int, class> class B>
+    inline bool LogWorkerDeferred<N, L, B>::enqueue(LogRecord parRecord)
+    {
+        #if JAUT_LOGGER_METRICS
+        const detail::MetricsStopwatch stopwatch;
+        #endif
+        
+        jdscoped Guard(lock);
+        
+        const int result = buffer.push(std::move(parRecord));
+        
+        #if JAUT_LOGGER_METRICS
+        metrics.recordPush(stopwatch.getElapsed(), result);
+        #endif
+        
+        return (result > -1);
+    }
+    
+    //==================================================================================================================
+    template<int N, class L, template<int, class> class B>
+    inline bool LogWorkerDeferred<N, L, B>::isEmpty() const
+    {
+        jdscoped Guard(lock);
+        return buffer.isEmpty();
+    }
+    
+    template<int N, class L, template<int, class> class B>
+    inline bool LogWorkerDeferred<N, L, B>::isFull() const
+    {
+        jdscoped Guard(lock);
+        return buffer.isFull();
+    }
+    
+    template<int N, class L, template<int, class> class B>
+    inline int LogWorkerDeferred<N, L, B>::size() const
+    {
+        jdscoped Guard(lock);
+        return buffer.size();
+    }
+    
+    template<int N, class L, template<int, class> class B>
+    inline int LogWorkerDeferred<N, L, B>::capacity() const
+    {
+        jdscoped Guard(lock);
+        return buffer.capacity();
+    }
+    
+    //==================================================================================================================
+    template<int N, class L, template<int, class> class B>
+    inline ILogWorker::FlushAttemptResult LogWorkerDeferred<N, L, B>::tryFlush(const LogRecord &parLastRecord)
+    {
+        return tryFlushFor(parLastRecord.getLevel(), [this, &parLastRecord]()
+        {
+            return parLastRecord.toMessage(logger->getNameSymbol());
+        });
+    }
+    
+    //==================================================================================================================
+    #if JAUT_LOGGER_METRICS
+    template<int N, class L, template<int, class> class B>
+    inline const LogWorkerMetrics* LogWorkerDeferred<N, L, B>::getMetrics() const noexcept
+    {
+        return &metrics;
+    }
+    #endif
+    
+    //==================================================================================================================
+    template<int N, class L, template<int, class> class B>
+    inline void LogWorkerDeferred<N, L, B>::processBuffer()
+    {
+        records.clear();
+        
+        if (buffer.popBatch(std::back_inserter(records), buffer.capacity()) == 0)
+        {
+            return;
+        }
+        
+        #if JAUT_LOGGER_METRICS
+        metrics.batchSize.record(records.size());
+        #endif
+        
+        // Rendering happens here, on the worker-thread, and only once for all sinks
+        messages.clear();
+        
+        for (LogRecord &record : records)
+        {
+            messages.emplace_back(record.message ? std::move(*record.message)
+                                                 : record.toMessage(logger->getNameSymbol()));
+        }
+        
+        for (const AbstractLogger::SinkPtr &sink_ptr : logger->getSinks())
+        {
+            sink_ptr->prepare(static_cast<int>(messages.size()));
+            
+            for (LogMessage &message : messages)
+            {
+                sink_ptr->print(message);
+            }
+            
+            sink_ptr->flush();
+        }
+        
+        // Keeps the capacity, but frees the messages right away instead of holding them until the next flush
+        records .clear();
+        messages.clear();
+    }
+}
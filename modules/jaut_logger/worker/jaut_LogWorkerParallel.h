@@ -0,0 +1,490 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogWorkerParallel.h
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+#pragma once
+
+#include <jaut_logger/jaut_logger_define.h>
+#include <jaut_logger/jaut_LogLevel.h>
+#include <jaut_logger/sink/jaut_ILogSink.h>
+#include <jaut_logger/worker/jaut_ILogWorker.h>
+#include <jaut_logger/worker/jaut_LogWorkerThreaded.h>
+
+#include <jaut_core/define/jaut_Define.h>
+
+#include <jaut_message/thread/buffer/jaut_AtomicRingBuffer.h>
+#include <jaut_message/thread/buffer/jaut_MpscRingBuffer.h>
+
+#include <juce_core/juce_core.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+
+
+namespace jaut
+{
+    //==================================================================================================================
+    /** Determines what a sink lane of jaut::LogWorkerParallel does when it can't keep up with incoming batches. */
+    enum class LaneOverflowPolicy
+    {
+        /** The batch will be dropped for this lane only and counted in LaneStatistics. */
+        Drop,
+        
+        /** The worker-thread will wait until the lane has room again, which also holds back all other lanes. */
+        Block
+    };
+    
+    /** A snapshot of the counters of a single sink lane of jaut::LogWorkerParallel. */
+    struct JAUT_API LaneStatistics
+    {
+        /** The number of batches currently waiting to be printed by the lane. */
+        int pendingBatches { 0 };
+        
+        /** The number of messages the lane has printed to its sink. */
+        std::uint64_t processedMessages { 0 };
+        
+        /** The number of messages the lane had to drop, because its queue was full. */
+        std::uint64_t droppedMessages { 0 };
+        
+        /** The number of batches the lane had to drop, because its queue was full. */
+        std::uint64_t droppedBatches { 0 };
+    };
+    
+    //==================================================================================================================
+    /**
+     *  The parallel log worker, an async worker that gives every sink its own lane.<br>
+     *  Like jaut::LogWorkerAsync, this will introduce a new thread to the logger that will consume messages,
+     *  but instead of printing them to all sinks one after another, it will hand every batch to one thread per sink.
+     *  <br><br>
+     *  All lanes share the very same immutable batch, so fanning out doesn't copy any messages.<br>
+     *  Each lane has its own bounded queue of LaneCapacity batches, so a slow sink, like a console or a rotating file
+     *  that is compressing its archive, will only ever hold back itself.
+     *  What happens if a lane's queue is full is determined by the Overflow policy, by default the batch will be
+     *  dropped for this lane and counted, see getLaneStatistics().
+     *  <br><br>
+     *  Sinks are opened on the thread that sets up the worker and closed on their lane, print and flush will
+     *  only ever be called from the lane of the sink.
+     *  <br><br>
+     *  Messages are printed in the order they were enqueued, which the buffer already guarantees.
+     *  Once the last lane is done with a batch, its storage will be reused for one of the next batches.
+     *  
+     *  @tparam BufferSize      The size of the message queue
+     *  @tparam CriticalSection A lock that allows multiple threads to log messages
+     *  @tparam Buffer          The message buffer template to use
+     *  @tparam LaneCapacity    The number of batches a sink lane can hold before it overflows
+     *  @tparam Overflow        What a sink lane should do when it overflows
+     */
+    template<int BufferSize = 512,
+             class CriticalSection = juce::DummyCriticalSection,
+             template<int, class> class Buffer = AtomicRingBuffer,
+             int LaneCapacity = 16,
+             LaneOverflowPolicy Overflow = LaneOverflowPolicy::Drop>
+    class JAUT_API LogWorkerParallel : public LogWorkerThreaded
+    {
+    public:
+        LogWorkerParallel();
+        
+        //==============================================================================================================
+        bool enqueue(LogMessage message) override;
+        
+        //==============================================================================================================
+        JAUT_NODISCARD bool isEmpty()  const override;
+        JAUT_NODISCARD bool isFull()   const override;
+        JAUT_NODISCARD int  size()     const override;
+        JAUT_NODISCARD int  capacity() const override;
+        
+        //==============================================================================================================
+        /**
+         *  Gets the number of lanes, which is the number of sinks the worker was set up with.
+         *  @return The number of lanes
+         */
+        JAUT_NODISCARD
+        int getNumLanes() const noexcept;
+        
+        /**
+         *  Gets a snapshot of the counters of a lane.<br>
+         *  Lanes are in the same order as the sinks of the logger.
+         *  
+         *  @param index The index of the lane
+         *  @return The lane's counters
+         */
+        JAUT_NODISCARD
+        LaneStatistics getLaneStatistics(int index) const;
+        
+        //==============================================================================================================
+        #if JAUT_LOGGER_METRICS
+        JAUT_NODISCARD
+        const LogWorkerMetrics* getMetrics() const noexcept override;
+        #endif
+        
+    private:
+        using BufferType   = Buffer<BufferSize, LogMessage>;
+        using ProducerLock = std::conditional_t<isMultiProducerBuffer_v<BufferType>, juce::DummyCriticalSection,
+                                                CriticalSection>;
+        using Guard        = typename ProducerLock::ScopedLockType;
+        using Batch        = std::shared_ptr<const std::vector<LogMessage>>;
+        using BatchStorage = std::unique_ptr<std::vector<LogMessage>>;
+        
+        //==============================================================================================================
+        class Lane : private juce::Thread
+        {
+        public:
+            explicit Lane(ILogSink &sink);
+            
+            //==========================================================================================================
+            void start();
+            void stop(bool drain);
+            
+            //==========================================================================================================
+            void push(const Batch &batch);
+            
+            //==========================================================================================================
+            JAUT_NODISCARD
+            LaneStatistics getStatistics() const;
+            
+        private:
+            ILogSink &sink;
+            
+            std::deque<Batch>          queue;
+            mutable std::mutex         mutex;
+            std::condition_variable    condition;
+            std::atomic<std::uint64_t> processedMessages { 0 };
+            std::atomic<std::uint64_t> droppedMessages   { 0 };
+            std::atomic<std::uint64_t> droppedBatches    { 0 };
+            bool                       shouldStop        { false };
+            bool                       shouldDrain       { true };
+            
+            //==========================================================================================================
+            void run() override;
+        };
+        
+        //==============================================================================================================
+        ProducerLock lock;
+        
+        BufferType                         buffer;
+        std::mutex                         spareMutex;
+        std::vector<BatchStorage>          spareBatches;
+        std::vector<std::unique_ptr<Lane>> lanes;
+        
+        #if JAUT_LOGGER_METRICS
+        LogWorkerMetrics metrics;
+        #endif
+        
+        //==============================================================================================================
+        void processBuffer() override;
+        void openSinks()     override;
+        void closeSinks()    override;
+        
+        //==============================================================================================================
+        BatchStorage takeSpareBatch();
+        void         recycleBatch(std::vector<LogMessage> *batch);
+    
+        //==============================================================================================================
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LogWorkerParallel)
+    };
+    
+    //==================================================================================================================
+    // IMPLEMENTATION Lane
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline LogWorkerParallel<N, L, B, C, O>::Lane::Lane(ILogSink &parSink)
+        : juce::Thread("Logger Lane"),
+          sink(parSink)
+    {}
+    
+    //==================================================================================================================
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline void LogWorkerParallel<N, L, B, C, O>::Lane::start()
+    {
+        startThread();
+    }
+    
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline void LogWorkerParallel<N, L, B, C, O>::Lane::stop(bool parDrain)
+    {
+        {
+            jdscoped std::lock_guard(mutex);
+            shouldStop  = true;
+            shouldDrain = parDrain;
+        }
+        
+        condition.notify_all();
+        stopThread(5000);
+    }
+    
+    //==================================================================================================================
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline void LogWorkerParallel<N, L, B, C, O>::Lane::push(const Batch &parBatch)
+    {
+        std::unique_lock guard(mutex);
+        
+        if constexpr (O == LaneOverflowPolicy::Block)
+        {
+            condition.wait(guard, [this]() { return (shouldStop || queue.size() < static_cast<std::size_t>(C)); });
+        }
+        else
+        {
+            if (queue.size() >= static_cast<std::size_t>(C))
+            {
+                droppedMessages.fetch_add(parBatch->size(), std::memory_order_relaxed);
+                droppedBatches .fetch_add(1,                std::memory_order_relaxed);
+                return;
+            }
+        }
+        
+        queue.emplace_back(parBatch);
+        guard.unlock();
+        
+        condition.notify_all();
+    }
+    
+    //==================================================================================================================
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline LaneStatistics LogWorkerParallel<N, L, B, C, O>::Lane::getStatistics() const
+    {
+        LaneStatistics statistics;
+        
+        {
+            jdscoped std::lock_guard(mutex);
+            statistics.pendingBatches = static_cast<int>(queue.size());
+        }
+        
+        statistics.processedMessages = processedMessages.load(std::memory_order_relaxed);
+        statistics.droppedMessages   = droppedMessages  .load(std::memory_order_relaxed);
+        statistics.droppedBatches    = droppedBatches   .load(std::memory_order_relaxed);
+        
+        return statistics;
+    }
+    
+    //==================================================================================================================
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline void LogWorkerParallel<N, L, B, C, O>::Lane::run()
+    {
+        for (;;)
+        {
+            Batch batch;
+            
+            {
+                std::unique_lock guard(mutex);
+                condition.wait(guard, [this]() { return (shouldStop || !queue.empty()); });
+                
+                if (queue.empty() || (shouldStop && !shouldDrain))
+                {
+                    break;
+                }
+                
+                batch = std::move(queue.front());
+                queue.pop_front();
+            }
+            
+            // There is room in the queue again, in case the worker-thread is waiting for it
+            condition.notify_all();
+            
+            sink.prepare(static_cast<int>(batch->size()));
+            
+            for (const LogMessage &message : *batch)
+            {
+                sink.print(message);
+            }
+            
+            sink.flush();
+            processedMessages.fetch_add(batch->size(), std::memory_order_relaxed);
+        }
+        
+        sink.onClose();
+    }
+    
+    //==================================================================================================================
+    // IMPLEMENTATION LogWorkerParallel
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline LogWorkerParallel<N, L, B, C, O>::LogWorkerParallel()
+    {
+        static_assert(C > 0, "LaneCapacity must be at least 1");
+    }
+    
+    //==================================================================================================================
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline bool LogWorkerParallel<N, L, B, C, O>::enqueue(LogMessage parMessage)
+    {
+        #if JAUT_LOGGER_METRICS
+        const detail::MetricsStopwatch stopwatch;
+        #endif
+        
+        jdscoped Guard(lock);
+        
+        const int result = buffer.push(std::move(parMessage));
+        
+        #if JAUT_LOGGER_METRICS
+        metrics.recordPush(stopwatch.getElapsed(), result);
+        #endif
+        
+        return (result > -1);
+    }
+    
+    //==================================================================================================================
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline bool LogWorkerParallel<N, L, B, C, O>::isEmpty() const
+    {
+        jdscoped Guard(lock);
+        return buffer.isEmpty();
+    }
+    
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline bool LogWorkerParallel<N, L, B, C, O>::isFull() const
+    {
+        jdscoped Guard(lock);
+        return buffer.isFull();
+    }
+    
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline int LogWorkerParallel<N, L, B, C, O>::size() const
+    {
+        jdscoped Guard(lock);
+        return buffer.size();
+    }
+    
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline int LogWorkerParallel<N, L, B, C, O>::capacity() const
+    {
+        jdscoped Guard(lock);
+        return buffer.capacity();
+    }
+    
+    //==================================================================================================================
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline int LogWorkerParallel<N, L, B, C, O>::getNumLanes() const noexcept
+    {
+        return static_cast<int>(lanes.size());
+    }
+    
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline LaneStatistics LogWorkerParallel<N, L, B, C, O>::getLaneStatistics(int parIndex) const
+    {
+        jassert(juce::isPositiveAndBelow(parIndex, getNumLanes()));
+        return lanes[static_cast<std::size_t>(parIndex)]->getStatistics();
+    }
+    
+    #if JAUT_LOGGER_METRICS
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline const LogWorkerMetrics* LogWorkerParallel<N, L, B, C, O>::getMetrics() const noexcept
+    {
+        return &metrics;
+    }
+    #endif
+    
+    //==================================================================================================================
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline void LogWorkerParallel<N, L, B, C, O>::processBuffer()
+    {
+        if (buffer.isEmpty())
+        {
+            return;
+        }
+        
+        BatchStorage messages = takeSpareBatch();
+        (void) buffer.popBatch(std::back_inserter(*messages), buffer.capacity());
+        
+        #if JAUT_LOGGER_METRICS
+        metrics.batchSize.record(messages->size());
+        #endif
+        
+        // Every lane gets the same batch, the last lane to finish printing it will hand it back to us
+        const Batch batch(std::shared_ptr<std::vector<LogMessage>>(messages.release(),
+                                                                   [this](std::vector<LogMessage> *parBatch)
+                                                                   {
+                                                                       recycleBatch(parBatch);
+                                                                   }));
+        
+        for (const std::unique_ptr<Lane> &lane : lanes)
+        {
+            lane->push(batch);
+        }
+    }
+    
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline void LogWorkerParallel<N, L, B, C, O>::openSinks()
+    {
+        lanes.clear();
+        lanes.reserve(logger->getSinks().size());
+        
+        for (const AbstractLogger::SinkPtr &sink_ptr : logger->getSinks())
+        {
+            sink_ptr->onOpen();
+            lanes.emplace_back(std::make_unique<Lane>(*sink_ptr))->start();
+        }
+    }
+    
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline void LogWorkerParallel<N, L, B, C, O>::closeSinks()
+    {
+        // Every sink is closed by its own lane, once it printed what was left for it
+        for (const std::unique_ptr<Lane> &lane : lanes)
+        {
+            lane->stop(flushBehaviour.flushOnFinalisation);
+        }
+    }
+    
+    //==================================================================================================================
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline typename LogWorkerParallel<N, L, B, C, O>::BatchStorage LogWorkerParallel<N, L, B, C, O>::takeSpareBatch()
+    {
+        {
+            jdscoped std::lock_guard(spareMutex);
+            
+            if (!spareBatches.empty())
+            {
+                BatchStorage spare = std::move(spareBatches.back());
+                spareBatches.pop_back();
+                
+                return spare;
+            }
+        }
+        
+        auto storage = std::make_unique<std::vector<LogMessage>>();
+        storage->reserve(static_cast<std::size_t>(N));
+        
+        return storage;
+    }
+    
+    template<int N, class L, template<int, class> class B, int C, LaneOverflowPolicy O>
+    inline void LogWorkerParallel<N, L, B, C, O>::recycleBatch(std::vector<LogMessage> *parBatch)
+    {
+        // This is called by whichever lane let go of the batch last, the messages are freed on that lane
+        BatchStorage storage(parBatch);
+        storage->clear();
+        
+        jdscoped std::lock_guard(spareMutex);
+        spareBatches.emplace_back(std::move(storage));
+    }
+}
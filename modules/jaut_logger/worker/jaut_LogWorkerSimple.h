@@ -40,6 +40,7 @@
 
 #include <jaut_core/define/jaut_Define.h>
 
+#include <jaut_message/thread/buffer/jaut_MpscRingBuffer.h>
 #include <jaut_message/thread/buffer/jaut_SimpleRingBuffer.h>
 
 #include <juce_core/juce_core.h>
@@ -52,18 +53,25 @@ namespace jaut
     /**
      *  The simple log worker which works synchronously to the thread the logger is owned by.<br>
      *  Do note that the logging thread will also be responsible for processing the messages.
+     *  <br><br>
+     *  If the buffer supports multiple producers, like jaut::MpscRingBuffer, the lock will only be taken by
+     *  whichever thread ends up flushing the buffer, enqueuing messages will then be entirely lock-free.
      *  
      *  @tparam BufferSize      The size of the buffer for log messages
      *  @tparam CriticalSection A lock that allows multiple threads to log messages
+     *  @tparam Buffer          The message buffer template to use
      */
-    template<int BufferSize = 512, class CriticalSection = juce::DummyCriticalSection>
+    template<int BufferSize = 512,
+             class CriticalSection = juce::DummyCriticalSection,
+             template<int, class> class Buffer = SimpleRingBuffer>
     class JAUT_API LogWorkerSimple : public ILogWorker
     {
     public:
-        LogWorkerSimple() = default;
+        LogWorkerSimple();
         
         //==============================================================================================================
         bool enqueue(LogMessage message) override;
+        bool enqueueReplacingOldest(LogMessage message) override;
     
         //==============================================================================================================
         void setup(AbstractLogger &logger, const FlushPolicy::Settings &flushPolicy) override;
@@ -79,18 +87,30 @@ namespace jaut
         bool               flush()                                 override;
         FlushAttemptResult tryFlush(const LogMessage &lastMessage) override;
         
+        //==============================================================================================================
+        #if JAUT_LOGGER_METRICS
+        JAUT_NODISCARD
+        const LogWorkerMetrics* getMetrics() const noexcept override;
+        #endif
+        
     private:
-        using Clock     = std::chrono::steady_clock;
-        using TimePoint = std::chrono::time_point<Clock>;
-        using Guard     = typename CriticalSection::ScopedLockType;
+        using Clock      = std::chrono::steady_clock;
+        using TimePoint  = std::chrono::time_point<Clock>;
+        using BufferType = Buffer<BufferSize, LogMessage>;
+        using Guard      = typename CriticalSection::ScopedLockType;
         
         //==============================================================================================================
         CriticalSection lock;
         
-        FlushPolicy::Settings                    flushBehaviour;
-        SimpleRingBuffer<BufferSize, LogMessage> buffer;
-        TimePoint                                lastTime;
-        AbstractLogger                           *logger { nullptr };
+        FlushPolicy::Settings   flushBehaviour;
+        BufferType              buffer;
+        std::vector<LogMessage> batch;
+        TimePoint               lastTime;
+        AbstractLogger          *logger { nullptr };
+        
+        #if JAUT_LOGGER_METRICS
+        LogWorkerMetrics metrics;
+        #endif
         
         //==============================================================================================================
         void flushInternal();
@@ -101,18 +121,58 @@ namespace jaut
     
     //==================================================================================================================
     // IMPLEMENTATION
-    template<int N, class L>
-    inline bool LogWorkerSimple<N, L>::enqueue(LogMessage parMessage)
+    template<int N, class L, template<int, class> class B>
+    inline LogWorkerSimple<N, L, B>::LogWorkerSimple()
+    {
+        batch.reserve(static_cast<std::size_t>(N));
+    }
+    
+    //==================================================================================================================
+    template<int N, class L, template<int, class> class B>
+    inline bool LogWorkerSimple<N, L, B>::enqueue(LogMessage parMessage)
     {
+        #if JAUT_LOGGER_METRICS
+        const detail::MetricsStopwatch stopwatch;
+        #endif
+        
+        const int result = [this, &parMessage]()
+        {
+            if constexpr (isMultiProducerBuffer_v<BufferType>)
+            {
+                return buffer.push(std::move(parMessage));
+            }
+            else
+            {
+                jdscoped Guard(lock);
+                return buffer.push(std::move(parMessage));
+            }
+        }();
+        
+        #if JAUT_LOGGER_METRICS
+        metrics.recordPush(stopwatch.getElapsed(), result);
+        #endif
+        
+        return (result > -1);
+    }
+    
+    template<int N, class L, template<int, class> class B>
+    inline bool LogWorkerSimple<N, L, B>::enqueueReplacingOldest(LogMessage parMessage)
+    {
+        // The flushing thread holds the same lock, so we can safely act as the consumer here
         jdscoped Guard(lock);
         
+        if (buffer.isFull())
+        {
+            (void) buffer.pop();
+        }
+        
         const int result = buffer.push(std::move(parMessage));
         return (result > -1);
     }
     
     //==================================================================================================================
-    template<int N, class L>
-    inline void LogWorkerSimple<N, L>::setup(AbstractLogger &parLogger, const FlushPolicy::Settings &parFlushPolicy)
+    template<int N, class L, template<int, class> class B>
+    inline void LogWorkerSimple<N, L, B>::setup(AbstractLogger &parLogger, const FlushPolicy::Settings &parFlushPolicy)
     {
         logger = &parLogger;
         
@@ -128,8 +188,8 @@ namespace jaut
         lastTime = Clock::now();
     }
     
-    template<int N, class L>
-    void LogWorkerSimple<N, L>::finalise()
+    template<int N, class L, template<int, class> class B>
+    void LogWorkerSimple<N, L, B>::finalise()
     {
         if (flushBehaviour.flushOnFinalisation)
         {
@@ -143,37 +203,65 @@ namespace jaut
     }
     
     //==================================================================================================================
-    template<int N, class L>
-    inline bool LogWorkerSimple<N, L>::isEmpty() const
+    template<int N, class L, template<int, class> class B>
+    inline bool LogWorkerSimple<N, L, B>::isEmpty() const
     {
-        jdscoped Guard(lock);
-        return buffer.isEmpty();
+        if constexpr (isMultiProducerBuffer_v<BufferType>)
+        {
+            return buffer.isEmpty();
+        }
+        else
+        {
+            jdscoped Guard(lock);
+            return buffer.isEmpty();
+        }
     }
     
-    template<int N, class L>
-    inline bool LogWorkerSimple<N, L>::isFull() const
+    template<int N, class L, template<int, class> class B>
+    inline bool LogWorkerSimple<N, L, B>::isFull() const
     {
-        jdscoped Guard(lock);
-        return buffer.isFull();
+        if constexpr (isMultiProducerBuffer_v<BufferType>)
+        {
+            return buffer.isFull();
+        }
+        else
+        {
+            jdscoped Guard(lock);
+            return buffer.isFull();
+        }
     }
     
-    template<int N, class L>
-    inline int LogWorkerSimple<N, L>::size() const
+    template<int N, class L, template<int, class> class B>
+    inline int LogWorkerSimple<N, L, B>::size() const
     {
-        jdscoped Guard(lock);
-        return buffer.size();
+        if constexpr (isMultiProducerBuffer_v<BufferType>)
+        {
+            return buffer.size();
+        }
+        else
+        {
+            jdscoped Guard(lock);
+            return buffer.size();
+        }
     }
     
-    template<int N, class L>
-    inline int LogWorkerSimple<N, L>::capacity() const
+    template<int N, class L, template<int, class> class B>
+    inline int LogWorkerSimple<N, L, B>::capacity() const
     {
-        jdscoped Guard(lock);
-        return buffer.capacity();
+        if constexpr (isMultiProducerBuffer_v<BufferType>)
+        {
+            return buffer.capacity();
+        }
+        else
+        {
+            jdscoped Guard(lock);
+            return buffer.capacity();
+        }
     }
     
     //==================================================================================================================
-    template<int N, class L>
-    inline bool LogWorkerSimple<N, L>::flush()
+    template<int N, class L, template<int, class> class B>
+    inline bool LogWorkerSimple<N, L, B>::flush()
     {
         if (!logger)
         {
@@ -184,8 +272,8 @@ namespace jaut
         return true;
     }
     
-    template<int N, class L>
-    inline ILogWorker::FlushAttemptResult LogWorkerSimple<N, L>::tryFlush(const LogMessage &parLastMessage)
+    template<int N, class L, template<int, class> class B>
+    inline ILogWorker::FlushAttemptResult LogWorkerSimple<N, L, B>::tryFlush(const LogMessage &parLastMessage)
     {
         if (!logger)
         {
@@ -212,33 +300,46 @@ namespace jaut
     }
     
     //==================================================================================================================
-    template<int N, class L>
-    void LogWorkerSimple<N, L>::flushInternal()
+    #if JAUT_LOGGER_METRICS
+    template<int N, class L, template<int, class> class B>
+    inline const LogWorkerMetrics* LogWorkerSimple<N, L, B>::getMetrics() const noexcept
+    {
+        return &metrics;
+    }
+    #endif
+    
+    //==================================================================================================================
+    template<int N, class L, template<int, class> class B>
+    void LogWorkerSimple<N, L, B>::flushInternal()
     {
         jdscoped Guard(lock);
         
-        if (!isEmpty())
+        batch.clear();
+        
+        // Producers might still be pushing while we print, so only what is in the buffer right now will be taken,
+        // otherwise the flushing thread could end up printing other threads' messages forever
+        if (buffer.popBatch(std::back_inserter(batch), buffer.size()) == 0)
         {
-            for (const AbstractLogger::SinkPtr &sink_ptr : logger->getSinks())
-            {
-                sink_ptr->prepare(size());
-            }
+            return;
+        }
+        
+        #if JAUT_LOGGER_METRICS
+        metrics.batchSize.record(batch.size());
+        #endif
+        
+        for (const AbstractLogger::SinkPtr &sink_ptr : logger->getSinks())
+        {
+            sink_ptr->prepare(static_cast<int>(batch.size()));
             
-            do
+            for (const LogMessage &message : batch)
             {
-                const LogMessage message = buffer.pop();
-                
-                for (const AbstractLogger::SinkPtr &sink_ptr : logger->getSinks())
-                {
-                    sink_ptr->print(message);
-                }
+                sink_ptr->print(message);
             }
-            while (!isEmpty());
             
-            for (const AbstractLogger::SinkPtr &sink_ptr : logger->getSinks())
-            {
-                sink_ptr->flush();
-            }
+            sink_ptr->flush();
         }
+        
+        // Keeps the capacity, but frees the messages right away instead of holding them until the next flush
+        batch.clear();
     }
 }
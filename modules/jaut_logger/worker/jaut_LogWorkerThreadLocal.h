@@ -0,0 +1,771 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogWorkerThreadLocal.h
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+#pragma once
+
+#include <jaut_logger/jaut_logger_define.h>
+#include <jaut_logger/jaut_LogLevel.h>
+#include <jaut_logger/sink/jaut_ILogSink.h>
+#include <jaut_logger/worker/jaut_ILogWorker.h>
+#include <jaut_logger/worker/jaut_LogRunMerger.h>
+
+#include <jaut_core/define/jaut_Define.h>
+
+#include <juce_core/juce_core.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+
+
+namespace jaut
+{
+    //==================================================================================================================
+    namespace detail
+    {
+        /**
+         *  Gets a new id that is unique for the lifetime of the program.<br>
+         *  This is used by jaut::LogWorkerThreadLocal to find the lane of a thread, addresses can't be used for that
+         *  as a new worker might end up at the address of one that was already destroyed.
+         *  
+         *  @return The new id, never 0
+         */
+        inline std::uint64_t nextThreadLocalWorkerId() noexcept
+        {
+            static std::atomic<std::uint64_t> counter { 0 };
+            return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+    }
+    
+    //==================================================================================================================
+    /**
+     *  The thread-local log worker, a synchronous worker for loggers that are used by many threads at the same time.
+     *  <br><br>
+     *  Every thread that logs gets its own lane, which collects messages in a batch of up to BufferSize messages.<br>
+     *  Once a batch is full, or its flush policy wants it to be printed, the batch will be handed off to a
+     *  lock-free list of pending batches, where whichever thread flushes next will pick it up.
+     *  <br><br>
+     *  Like jaut::LogWorkerSimple there is no extra thread, a flush is done by the logging thread that triggered it.
+     *  However, only one thread can be flushing at a time, and instead of waiting for it, other threads that want
+     *  to flush will leave their batches to the thread that is already flushing and continue right away.
+     *  So a thread will never have to wait for another thread's sinks, the lock of a lane is only ever held to
+     *  swap the batch of a lane and is uncontended most of the time.
+     *  <br><br>
+     *  All batches that are printed together are merged by their timestamp, using jaut::LogRunMerger, so messages
+     *  of different threads will end up in the order they were logged in.
+     *  <br><br>
+     *  With FlushPolicy::Timed, the deadline of a batch starts with its first message.
+     *  Batches of threads that don't log anymore will be picked up by the next flush that is due or when the
+     *  worker is finalised, if flushing on finalisation was requested.
+     *  <br><br>
+     *  When a thread exits, its lane is marked as retired and released by the next flush, together with any batch
+     *  that was left in it. So hosts that keep spawning new threads don't pile up lanes of threads that are long gone.
+     *  
+     *  @tparam BufferSize        The number of messages a lane can collect before its batch is handed off
+     *  @tparam MaxPendingBatches The number of handed off batches that can wait for a flush before enqueuing fails
+     */
+    template<int BufferSize = 512, int MaxPendingBatches = 16>
+    class JAUT_API LogWorkerThreadLocal : public ILogWorker
+    {
+    public:
+        static_assert(BufferSize > 0,        "BufferSize must be at least 1");
+        static_assert(MaxPendingBatches > 0, "MaxPendingBatches must be at least 1");
+        
+        //==============================================================================================================
+        LogWorkerThreadLocal() = default;
+        ~LogWorkerThreadLocal() override;
+        
+        //==============================================================================================================
+        void setup(AbstractLogger &logger, const FlushPolicy::Settings &flushPolicy) override;
+        void finalise() override;
+        
+        //==============================================================================================================
+        bool enqueue(LogMessage message) override;
+        
+        //==============================================================================================================
+        JAUT_NODISCARD bool isEmpty()  const override;
+        JAUT_NODISCARD bool isFull()   const override;
+        JAUT_NODISCARD int  size()     const override;
+        JAUT_NODISCARD int  capacity() const override;
+        
+        //==============================================================================================================
+        bool               flush()                                 override;
+        FlushAttemptResult tryFlush(const LogMessage &lastMessage) override;
+        
+        //==============================================================================================================
+        /**
+         *  Gets the number of lanes, which is the number of threads that have logged to this worker so far.<br>
+         *  Lanes of threads that have exited are only released by the next flush, until then they are still counted.
+         *  
+         *  @return The number of lanes
+         */
+        JAUT_NODISCARD
+        int getNumLanes() const;
+        
+        //==============================================================================================================
+        #if JAUT_LOGGER_METRICS
+        JAUT_NODISCARD
+        const LogWorkerMetrics* getMetrics() const noexcept override;
+        #endif
+    
+    private:
+        using Clock     = std::chrono::steady_clock;
+        using TimePoint = std::chrono::time_point<Clock>;
+        using Guard     = juce::SpinLock::ScopedLockType;
+        
+        //==============================================================================================================
+        struct Lane;
+        
+        struct Batch
+        {
+            std::vector<LogMessage> messages;
+            Lane                    *lane { nullptr };
+            Batch                   *next { nullptr };
+        };
+        
+        struct Lane
+        {
+            juce::SpinLock         lock;
+            std::unique_ptr<Batch> batch;
+            std::atomic<Batch*>    spare { nullptr };
+            TimePoint              deadline;
+            std::atomic<bool>      retired { false };
+            
+            //==========================================================================================================
+            ~Lane() { delete spare.load(); }
+        };
+        
+        enum class Collect
+        {
+            None,
+            Expired,
+            All
+        };
+        
+        //==============================================================================================================
+        const std::uint64_t id { detail::nextThreadLocalWorkerId() };
+        
+        FlushPolicy::Settings flushBehaviour;
+        AbstractLogger        *logger { nullptr };
+        
+        std::vector<std::shared_ptr<Lane>> lanes;
+        mutable std::mutex                 laneMutex;
+        
+        std::atomic<Batch*> pending            { nullptr };
+        std::atomic<int>    numPendingBatches  { 0 };
+        std::atomic<int>    numPendingMessages { 0 };
+        std::atomic<bool>   flushing           { false };
+        std::atomic<bool>   collectRequested   { false };
+        std::atomic<bool>   pruneRequested     { false };
+        std::atomic<bool>   finalising         { false };
+        
+        std::mutex              flushMutex;
+        std::condition_variable flushFinished;
+        
+        // Only ever touched by the thread that is flushing
+        std::vector<Batch*>                  drained;
+        std::vector<Batch*>                  collected;
+        std::vector<std::shared_ptr<Lane>>   released;
+        std::vector<std::vector<LogMessage>> runs;
+        std::vector<LogMessage>              merged;
+        LogRunMerger                         merger;
+        
+        #if JAUT_LOGGER_METRICS
+        LogWorkerMetrics metrics;
+        #endif
+        
+        //==============================================================================================================
+        Lane& getLane();
+        
+        //==============================================================================================================
+        Batch* takeBatch(Lane &lane);
+        bool   handOff(Lane &lane);
+        void   recycleBatch(Batch *batch);
+        
+        //==============================================================================================================
+        bool tryBeginFlush() noexcept;
+        void endFlush();
+        void flushPending(Collect collect);
+        void collectLanes(Collect collect, TimePoint now);
+        void printDrained();
+        void recycleDrained();
+        
+        //==============================================================================================================
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LogWorkerThreadLocal)
+    };
+    
+    //==================================================================================================================
+    // IMPLEMENTATION
+    template<int N, int M>
+    inline LogWorkerThreadLocal<N, M>::~LogWorkerThreadLocal()
+    {
+        Batch *batch = pending.exchange(nullptr);
+        
+        while (batch)
+        {
+            Batch *const next = batch->next;
+            delete batch;
+            batch = next;
+        }
+    }
+    
+    //==================================================================================================================
+    template<int N, int M>
+    inline void LogWorkerThreadLocal<N, M>::setup(AbstractLogger              &parLogger,
+                                                  const FlushPolicy::Settings &parFlushPolicy)
+    {
+        logger = &parLogger;
+        
+        using std::swap;
+        FlushPolicy::Settings temp_policy(parFlushPolicy);
+        swap(flushBehaviour, temp_policy);
+        
+        for (const AbstractLogger::SinkPtr &sink_ptr : parLogger.getSinks())
+        {
+            sink_ptr->onOpen();
+        }
+    }
+    
+    template<int N, int M>
+    inline void LogWorkerThreadLocal<N, M>::finalise()
+    {
+        // Nobody should be logging anymore at this point, but another thread might still be in the middle of a flush
+        finalising.store(true);
+        
+        while (!tryBeginFlush())
+        {
+            std::unique_lock guard(flushMutex);
+            flushFinished.wait(guard, [this]() { return !flushing.load(); });
+        }
+        
+        if (flushBehaviour.flushOnFinalisation)
+        {
+            flushPending(Collect::All);
+        }
+        else
+        {
+            endFlush();
+        }
+        
+        for (const AbstractLogger::SinkPtr &sink_ptr : logger->getSinks())
+        {
+            sink_ptr->onClose();
+        }
+    }
+    
+    //==================================================================================================================
+    template<int N, int M>
+    inline bool LogWorkerThreadLocal<N, M>::enqueue(LogMessage parMessage)
+    {
+        #if JAUT_LOGGER_METRICS
+        const detail::MetricsStopwatch stopwatch;
+        #endif
+        
+        Lane &lane = getLane();
+        
+        const int result = [this, &lane, &parMessage]()
+        {
+            jdscoped Guard(lane.lock);
+            
+            // The last batch was full but there was no room to hand it off, so we have to try that again first
+            if (lane.batch && lane.batch->messages.size() >= static_cast<std::size_t>(N) && !handOff(lane))
+            {
+                return -1;
+            }
+            
+            if (!lane.batch)
+            {
+                lane.batch.reset(takeBatch(lane));
+                lane.deadline = Clock::now() + std::chrono::seconds(flushBehaviour.interval);
+            }
+            
+            std::vector<LogMessage> &messages = lane.batch->messages;
+            messages.push_back(std::move(parMessage));
+            
+            const int size = static_cast<int>(messages.size());
+            
+            if (size >= N)
+            {
+                (void) handOff(lane);
+            }
+            
+            return size;
+        }();
+        
+        #if JAUT_LOGGER_METRICS
+        metrics.recordEnqueue(stopwatch.getElapsed(), result);
+        #endif
+        
+        return (result > -1);
+    }
+    
+    //==================================================================================================================
+    template<int N, int M>
+    inline bool LogWorkerThreadLocal<N, M>::isEmpty() const
+    {
+        return (size() == 0);
+    }
+    
+    template<int N, int M>
+    inline bool LogWorkerThreadLocal<N, M>::isFull() const
+    {
+        return (numPendingBatches.load(std::memory_order_relaxed) >= M);
+    }
+    
+    template<int N, int M>
+    inline int LogWorkerThreadLocal<N, M>::size() const
+    {
+        int result = numPendingMessages.load(std::memory_order_relaxed);
+        
+        jdscoped std::lock_guard(laneMutex);
+        
+        for (const std::shared_ptr<Lane> &lane : lanes)
+        {
+            jdscoped Guard(lane->lock);
+            
+            if (lane->batch)
+            {
+                result += static_cast<int>(lane->batch->messages.size());
+            }
+        }
+        
+        return result;
+    }
+    
+    template<int N, int M>
+    inline int LogWorkerThreadLocal<N, M>::capacity() const
+    {
+        return (N * M);
+    }
+    
+    //==================================================================================================================
+    template<int N, int M>
+    inline bool LogWorkerThreadLocal<N, M>::flush()
+    {
+        if (!logger)
+        {
+            return false;
+        }
+        
+        // If another thread is flushing right now, it will see this and pick up all lanes once it's done
+        collectRequested.store(true);
+        
+        if (tryBeginFlush())
+        {
+            flushPending(Collect::All);
+        }
+        
+        return true;
+    }
+    
+    template<int N, int M>
+    inline ILogWorker::FlushAttemptResult LogWorkerThreadLocal<N, M>::tryFlush(const LogMessage &parLastMessage)
+    {
+        if (!logger)
+        {
+            return ILogWorker::FlushAttemptResult::NotReady;
+        }
+        
+        const TimePoint now     = Clock::now();
+        Collect         collect = Collect::None;
+        
+        if (    flushBehaviour.policies.test(FlushPolicy::Instant)
+            || (flushBehaviour.policies.test(FlushPolicy::Levelled) && parLastMessage.level >= flushBehaviour.level)
+            || (flushBehaviour.policies.test(FlushPolicy::Custom)   && flushBehaviour.customPolicy(parLastMessage)))
+        {
+            collect = Collect::All;
+            collectRequested.store(true);
+        }
+        else if (flushBehaviour.policies.test(FlushPolicy::Timed))
+        {
+            Lane &lane = getLane();
+            
+            jdscoped Guard(lane.lock);
+            
+            if (lane.batch && now >= lane.deadline)
+            {
+                collect = Collect::Expired;
+            }
+        }
+        
+        if (   collect == Collect::None
+            && !(flushBehaviour.policies.test(FlushPolicy::Filled) && numPendingBatches.load() > 0))
+        {
+            return ILogWorker::FlushAttemptResult::Unsuccessful;
+        }
+        
+        if (!tryBeginFlush())
+        {
+            return ILogWorker::FlushAttemptResult::Async;
+        }
+        
+        flushPending(collect);
+        return ILogWorker::FlushAttemptResult::Successful;
+    }
+    
+    //==================================================================================================================
+    template<int N, int M>
+    inline int LogWorkerThreadLocal<N, M>::getNumLanes() const
+    {
+        jdscoped std::lock_guard(laneMutex);
+        return static_cast<int>(lanes.size());
+    }
+    
+    //==================================================================================================================
+    #if JAUT_LOGGER_METRICS
+    template<int N, int M>
+    inline const LogWorkerMetrics* LogWorkerThreadLocal<N, M>::getMetrics() const noexcept
+    {
+        return &metrics;
+    }
+    #endif
+    
+    //==================================================================================================================
+    template<int N, int M>
+    inline typename LogWorkerThreadLocal<N, M>::Lane& LogWorkerThreadLocal<N, M>::getLane()
+    {
+        struct CachedLane
+        {
+            std::uint64_t id;
+            Lane          *lane;
+        };
+        
+        struct ThreadLane
+        {
+            std::uint64_t       id;
+            Lane                *lane;
+            std::weak_ptr<Lane> owner;
+        };
+        
+        struct ThreadLanes
+        {
+            std::vector<ThreadLane> entries;
+            
+            //==========================================================================================================
+            ~ThreadLanes()
+            {
+                // The thread is exiting, so its lanes can be released by the next flush of their worker
+                for (const ThreadLane &thread_lane : entries)
+                {
+                    if (const std::shared_ptr<Lane> lane = thread_lane.owner.lock())
+                    {
+                        lane->retired.store(true, std::memory_order_release);
+                    }
+                }
+            }
+        };
+        
+        // Most threads will only ever log to one logger, so the last lane is remembered to skip the lookup
+        thread_local CachedLane  last_lane { 0, nullptr };
+        thread_local ThreadLanes thread_lanes;
+        
+        if (last_lane.id == id)
+        {
+            return *last_lane.lane;
+        }
+        
+        std::vector<ThreadLane> &entries = thread_lanes.entries;
+        
+        auto it = std::find_if(entries.begin(), entries.end(), [this](const ThreadLane &parThreadLane)
+        {
+            return (parThreadLane.id == id);
+        });
+        
+        if (it == entries.end())
+        {
+            // Lanes are owned by their worker, so once a worker is gone, this thread is the only one still knowing
+            // about its lane and has to forget it, or it would pile up entries for every worker it ever logged to
+            entries.erase(std::remove_if(entries.begin(), entries.end(), [](const ThreadLane &parThreadLane)
+                                         {
+                                             return parThreadLane.owner.expired();
+                                         }),
+                          entries.end());
+            
+            auto lane = std::make_shared<Lane>();
+            
+            {
+                jdscoped std::lock_guard(laneMutex);
+                lanes.emplace_back(lane);
+            }
+            
+            // A new thread might have replaced one that exited, so let the next flush look for retired lanes
+            pruneRequested.store(true, std::memory_order_relaxed);
+            
+            it = entries.insert(entries.end(), ThreadLane{ id, lane.get(), lane });
+        }
+        
+        last_lane = { id, it->lane };
+        return *it->lane;
+    }
+    
+    //==================================================================================================================
+    template<int N, int M>
+    inline typename LogWorkerThreadLocal<N, M>::Batch* LogWorkerThreadLocal<N, M>::takeBatch(Lane &parLane)
+    {
+        if (Batch *const batch = parLane.spare.exchange(nullptr, std::memory_order_acquire))
+        {
+            return batch;
+        }
+        
+        Batch *const batch = new Batch();
+        batch->lane = &parLane;
+        batch->messages.reserve(static_cast<std::size_t>(N));
+        
+        return batch;
+    }
+    
+    template<int N, int M>
+    inline bool LogWorkerThreadLocal<N, M>::handOff(Lane &parLane)
+    {
+        if (numPendingBatches.fetch_add(1) >= M)
+        {
+            numPendingBatches.fetch_sub(1);
+            return false;
+        }
+        
+        Batch *const batch = parLane.batch.release();
+        numPendingMessages.fetch_add(static_cast<int>(batch->messages.size()), std::memory_order_relaxed);
+        
+        batch->next = pending.load(std::memory_order_relaxed);
+        
+        while (!pending.compare_exchange_weak(batch->next, batch, std::memory_order_release,
+                                              std::memory_order_relaxed));
+        
+        return true;
+    }
+    
+    template<int N, int M>
+    inline void LogWorkerThreadLocal<N, M>::recycleBatch(Batch *parBatch)
+    {
+        // Keeps the capacity, but frees the messages right away instead of holding them until the batch is reused
+        parBatch->messages.clear();
+        parBatch->next = nullptr;
+        
+        delete parBatch->lane->spare.exchange(parBatch, std::memory_order_acq_rel);
+    }
+    
+    //==================================================================================================================
+    template<int N, int M>
+    inline bool LogWorkerThreadLocal<N, M>::tryBeginFlush() noexcept
+    {
+        return !flushing.exchange(true);
+    }
+    
+    template<int N, int M>
+    inline void LogWorkerThreadLocal<N, M>::endFlush()
+    {
+        flushing.store(false);
+        
+        // Only finalise() ever waits for a flush to end, so there is no need to lock for anyone else
+        if (finalising.load())
+        {
+            jdscoped std::lock_guard(flushMutex);
+            flushFinished.notify_all();
+        }
+    }
+    
+    template<int N, int M>
+    inline void LogWorkerThreadLocal<N, M>::flushPending(Collect parCollect)
+    {
+        for (;;)
+        {
+            try
+            {
+                const Collect collect = (collectRequested.exchange(false) ? Collect::All : parCollect);
+                
+                // Lanes have to be collected first, so that a batch a lane hands off in the meantime can only ever
+                // contain messages that are newer than what we collected
+                collectLanes(collect, Clock::now());
+                
+                Batch *batch = pending.exchange(nullptr, std::memory_order_acquire);
+                
+                while (batch)
+                {
+                    drained.push_back(batch);
+                    batch = batch->next;
+                }
+                
+                // The list is a stack, so the oldest batch is at the end
+                std::reverse(drained.begin(), drained.end());
+                
+                int num_batches  = 0;
+                int num_messages = 0;
+                
+                for (const Batch *drained_batch : drained)
+                {
+                    ++num_batches;
+                    num_messages += static_cast<int>(drained_batch->messages.size());
+                }
+                
+                numPendingBatches .fetch_sub(num_batches);
+                numPendingMessages.fetch_sub(num_messages, std::memory_order_relaxed);
+                
+                // Collected batches come last, as they are always newer than handed off batches of the same lane
+                drained.insert(drained.end(), collected.begin(), collected.end());
+                collected.clear();
+                
+                printDrained();
+                recycleDrained();
+                released.clear();
+            }
+            catch (...)
+            {
+                recycleDrained();
+                released.clear();
+                endFlush();
+                
+                throw;
+            }
+            
+            endFlush();
+            
+            // Another thread might have handed off or requested a flush while we were busy and left it to us
+            if (   (pending.load() == nullptr && !collectRequested.load())
+                || !tryBeginFlush())
+            {
+                return;
+            }
+            
+            parCollect = Collect::None;
+        }
+    }
+    
+    template<int N, int M>
+    inline void LogWorkerThreadLocal<N, M>::collectLanes(Collect parCollect, TimePoint parNow)
+    {
+        const bool prune = pruneRequested.exchange(false, std::memory_order_relaxed);
+        
+        if (parCollect == Collect::None && !prune)
+        {
+            return;
+        }
+        
+        jdscoped std::lock_guard(laneMutex);
+        
+        for (auto it = lanes.begin(); it != lanes.end();)
+        {
+            Lane &lane = **it;
+            
+            // Once a lane is retired, every batch it handed off is already in the pending list, which is drained
+            // right after this, so it is safe to release the lane once this flush has recycled its batches
+            const bool retired = lane.retired.load(std::memory_order_acquire);
+            
+            {
+                jdscoped Guard(lane.lock);
+                
+                if (   lane.batch && !lane.batch->messages.empty()
+                    && (retired || parCollect == Collect::All
+                        || (parCollect == Collect::Expired && parNow >= lane.deadline)))
+                {
+                    collected.push_back(lane.batch.release());
+                }
+            }
+            
+            if (retired)
+            {
+                released.push_back(std::move(*it));
+                it = lanes.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+    
+    template<int N, int M>
+    inline void LogWorkerThreadLocal<N, M>::printDrained()
+    {
+        runs.resize(drained.size());
+        
+        for (std::size_t i = 0; i < drained.size(); ++i)
+        {
+            std::swap(runs[i], drained[i]->messages);
+        }
+        
+        merged.clear();
+        merger.merge(runs, std::back_inserter(merged), [](const LogMessage &left, const LogMessage &right)
+        {
+            return (left.timestamp < right.timestamp);
+        });
+        
+        for (std::size_t i = 0; i < drained.size(); ++i)
+        {
+            std::swap(runs[i], drained[i]->messages);
+        }
+        
+        if (merged.empty())
+        {
+            return;
+        }
+        
+        #if JAUT_LOGGER_METRICS
+        metrics.batchSize.record(static_cast<std::uint64_t>(merged.size()));
+        #endif
+        
+        for (const AbstractLogger::SinkPtr &sink_ptr : logger->getSinks())
+        {
+            sink_ptr->prepare(static_cast<int>(merged.size()));
+            
+            for (const LogMessage &message : merged)
+            {
+                sink_ptr->print(message);
+            }
+            
+            sink_ptr->flush();
+        }
+        
+        merged.clear();
+    }
+    
+    template<int N, int M>
+    inline void LogWorkerThreadLocal<N, M>::recycleDrained()
+    {
+        for (Batch *batch : drained)
+        {
+            recycleBatch(batch);
+        }
+        
+        for (Batch *batch : collected)
+        {
+            recycleBatch(batch);
+        }
+        
+        drained  .clear();
+        collected.clear();
+    }
+}
@@ -0,0 +1,168 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogWorkerThreaded.cpp
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+#include <jaut_logger/worker/jaut_LogWorkerThreaded.h>
+
+#include <jaut_logger/jaut_AbstractLogger.h>
+#include <jaut_logger/sink/jaut_ILogSink.h>
+
+
+
+//**********************************************************************************************************************
+// region LogWorkerThreaded
+//======================================================================================================================
+namespace jaut
+{
+    //==================================================================================================================
+    LogWorkerThreaded::LogWorkerThreaded()
+        : juce::Thread("Logger")
+    {}
+    
+    //==================================================================================================================
+    void LogWorkerThreaded::setup(AbstractLogger &parLogger, const FlushPolicy::Settings &parFlushPolicy)
+    {
+        logger = &parLogger;
+        
+        using std::swap;
+        FlushPolicy::Settings temp_policy(parFlushPolicy);
+        swap(flushBehaviour, temp_policy);
+        
+        openSinks();
+        
+        lastTime = Clock::now();
+        
+        startThread();
+    }
+    
+    void LogWorkerThreaded::finalise()
+    {
+        // The remaining messages will be flushed by the worker-thread itself before it exits,
+        // if flushing on finalisation was requested
+        stopThread(5000);
+    }
+    
+    //==================================================================================================================
+    bool LogWorkerThreaded::flush()
+    {
+        if (!logger)
+        {
+            return false;
+        }
+        
+        dirty = true;
+        notify();
+        
+        return true;
+    }
+    
+    ILogWorker::FlushAttemptResult LogWorkerThreaded::tryFlush(const LogMessage &parLastMessage)
+    {
+        return tryFlushFor(parLastMessage.level, [&parLastMessage]() -> const LogMessage&
+        {
+            return parLastMessage;
+        });
+    }
+    
+    //==================================================================================================================
+    void LogWorkerThreaded::openSinks()
+    {
+        for (const AbstractLogger::SinkPtr &sink_ptr : logger->getSinks())
+        {
+            sink_ptr->onOpen();
+        }
+    }
+    
+    void LogWorkerThreaded::closeSinks()
+    {
+        for (const AbstractLogger::SinkPtr &sink_ptr : logger->getSinks())
+        {
+            sink_ptr->onClose();
+        }
+    }
+    
+    //==================================================================================================================
+    void LogWorkerThreaded::run()
+    {
+        while (!threadShouldExit())
+        {
+            const int timeout = getWaitTimeout();
+            
+            if (dirty.exchange(false))
+            {
+                processBuffer();
+                continue;
+            }
+            
+            // Sleeps until either flush() or stopThread() notifies us or the next timed flush is due,
+            // so an idle logger doesn't cost us any cycles
+            (void) wait(timeout);
+        }
+        
+        if (flushBehaviour.flushOnFinalisation)
+        {
+            processBuffer();
+        }
+        
+        closeSinks();
+    }
+    
+    //==================================================================================================================
+    int LogWorkerThreaded::getWaitTimeout()
+    {
+        int timeout = JAUT_LOGGER_ASYNC_SLEEP;
+        
+        if (flushBehaviour.policies.test(FlushPolicy::Timed))
+        {
+            const TimePoint now      = Clock::now();
+            const auto      interval = std::chrono::milliseconds(std::chrono::seconds(flushBehaviour.interval));
+            const auto      elapsed  = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastTime);
+            
+            if (elapsed >= interval)
+            {
+                dirty    = true;
+                lastTime = now;
+                
+                return 0;
+            }
+            
+            const int remaining = static_cast<int>((interval - elapsed).count());
+            timeout = (timeout < 0 ? remaining : std::min(timeout, remaining));
+        }
+        
+        return timeout;
+    }
+}
+//======================================================================================================================
+// endregion LogWorkerThreaded
+//**********************************************************************************************************************
@@ -0,0 +1,153 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   jaut_LogWorkerThreaded.h
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+#pragma once
+
+#include <jaut_logger/jaut_logger_define.h>
+#include <jaut_logger/jaut_LogLevel.h>
+#include <jaut_logger/worker/jaut_ILogWorker.h>
+
+#include <jaut_core/define/jaut_Define.h>
+
+#include <juce_core/juce_core.h>
+
+#include <atomic>
+#include <chrono>
+
+
+
+namespace jaut
+{
+    //==================================================================================================================
+    /**
+     *  The base of all log workers that consume messages on a worker-thread of their own.<br>
+     *  This takes care of the thread, the flush policies and timed flushes, so implementations only have to manage
+     *  their buffer and decide how a batch makes it to the sinks.
+     *  <br><br>
+     *  The worker-thread does not poll, it sleeps until a flush has been requested or the next timed flush is due.
+     *  Whenever it wakes up for a flush, it will call processBuffer().
+     *  <br><br>
+     *  Sinks are opened by setup() on the calling thread and closed on the worker-thread before it exits.
+     */
+    class JAUT_API LogWorkerThreaded : public ILogWorker, private juce::Thread
+    {
+    public:
+        void setup(AbstractLogger &logger, const FlushPolicy::Settings &flushPolicy) override;
+        void finalise() override;
+        
+        //==============================================================================================================
+        bool               flush()                                 override;
+        FlushAttemptResult tryFlush(const LogMessage &lastMessage) override;
+    
+    protected:
+        FlushPolicy::Settings flushBehaviour;
+        AbstractLogger        *logger { nullptr };
+        
+        //==============================================================================================================
+        LogWorkerThreaded();
+        
+        //==============================================================================================================
+        /**
+         *  Tries to flush the buffer to all sinks if one of the given flushing policies was satisfied.<br>
+         *  This is meant for workers that don't have a message at hand, the message for the custom policy will only
+         *  be made if the policy is actually checked.
+         *  
+         *  @param level   The level of the last entry that was enqueued
+         *  @param message A function that returns the last entry as message
+         *  @return The flush result
+         */
+        template<class MessageFunction>
+        FlushAttemptResult tryFlushFor(LogLevel::Value level, MessageFunction &&message);
+        
+        //==============================================================================================================
+        /** Called on the worker-thread whenever a flush is due, prints everything that was enqueued so far. */
+        virtual void processBuffer() = 0;
+        
+        /** Called by setup() before the worker-thread is started, by default this opens all sinks. */
+        virtual void openSinks();
+        
+        /** Called on the worker-thread after its last flush, by default this closes all sinks. */
+        virtual void closeSinks();
+    
+    private:
+        using Clock     = std::chrono::steady_clock;
+        using TimePoint = std::chrono::time_point<Clock>;
+        
+        //==============================================================================================================
+        TimePoint lastTime;
+        
+        std::atomic<bool> dirty { false };
+        
+        //==============================================================================================================
+        void run() override;
+        
+        //==============================================================================================================
+        int getWaitTimeout();
+        
+        //==============================================================================================================
+        JUCE_DECLARE_NON_COPYABLE(LogWorkerThreaded)
+    };
+    
+    //==================================================================================================================
+    // IMPLEMENTATION
+    template<class MessageFunction>
+    inline ILogWorker::FlushAttemptResult LogWorkerThreaded::tryFlushFor(LogLevel::Value   parLevel,
+                                                                         MessageFunction &&parMessage)
+    {
+        if (!logger)
+        {
+            return ILogWorker::FlushAttemptResult::NotReady;
+        }
+        
+        if (dirty)
+        {
+            return ILogWorker::FlushAttemptResult::Async;
+        }
+        
+        if (    flushBehaviour.policies.test(FlushPolicy::Instant)
+            || (flushBehaviour.policies.test(FlushPolicy::Filled)   && isFull())
+            || (flushBehaviour.policies.test(FlushPolicy::Levelled) && parLevel >= flushBehaviour.level)
+            || (flushBehaviour.policies.test(FlushPolicy::Custom)   && flushBehaviour.customPolicy(parMessage())))
+        {
+            flush();
+            
+            if (!dirty)
+            {
+                return ILogWorker::FlushAttemptResult::Successful;
+            }
+        }
+        
+        return ILogWorker::FlushAttemptResult::Async;
+    }
+}
@@ -58,6 +58,8 @@
 #include <jaut_message/thread/jaut_MessageDirection.h>
 #include <jaut_message/thread/jaut_MessageHandler.h>
 #include <jaut_message/thread/buffer/jaut_AtomicRingBuffer.h>
+#include <jaut_message/thread/buffer/jaut_FastAtomicRingBuffer.h>
+#include <jaut_message/thread/buffer/jaut_MpscRingBuffer.h>
 #include <jaut_message/thread/buffer/jaut_SimpleRingBuffer.h>
 #include <jaut_message/thread/exception/jaut_QueueSpaceExceededException.h>
 #include <jaut_message/thread/message/inbuilt/jaut_MessageCallback.h>
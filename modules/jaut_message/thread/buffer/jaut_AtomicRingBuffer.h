@@ -39,8 +39,10 @@
 #include <jaut_core/define/jaut_Define.h>
 #include <jaut_message/thread/message/jaut_IMessageBuffer.h>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <iterator>
 
 
 
@@ -71,6 +73,9 @@ namespace jaut
          */
         static constexpr int actualSize = (BufferSize + 1);
         
+        /** Whether this buffer allows pushing messages from more than one thread at the same time. */
+        static constexpr bool multiProducer = false;
+        
         //==============================================================================================================
         /** Constructs a new AtomicRingBuffer. */
         AtomicRingBuffer() noexcept = default;
@@ -81,6 +86,28 @@ namespace jaut
         JAUT_NODISCARD
         T pop() override;
         
+        //==============================================================================================================
+        /**
+         *  Pops up to the given amount of messages from the buffer and writes them to the output iterator.
+         *  Head and tail will only be touched once for the entire batch.
+         *  
+         *  @param output The output iterator to write the popped messages to
+         *  @param max    The maximum amount of messages to pop
+         *  @return The number of messages that were popped
+         */
+        template<class OutputIt>
+        int popBatch(OutputIt output, int max);
+        
+        /**
+         *  Pushes as many messages from the given range as fit into the buffer.
+         *  Head and tail will only be touched once for the entire batch.
+         *  
+         *  @param range The range of messages to push, the pushed elements will be moved from
+         *  @return The number of messages that were pushed, starting from the beginning of the range
+         */
+        template<class Range>
+        int pushBatch(Range &&range);
+        
         //==============================================================================================================
         JAUT_NODISCARD
         int size() const noexcept override;
@@ -142,6 +169,55 @@ namespace jaut
         return message;
     }
     
+    //==================================================================================================================
+    template<int N, class T>
+    template<class OutputIt>
+    inline int AtomicRingBuffer<N, T>::popBatch(OutputIt parOutput, int parMax)
+    {
+        const int current_tail = tail.load(std::memory_order_relaxed);
+        const int current_head = head.load(std::memory_order_acquire);
+        const int count        = std::min(calculateSize(current_head, current_tail), parMax);
+        
+        for (int i = 0; i < count; ++i)
+        {
+            T message {};
+            std::swap(message, buffer[static_cast<std::size_t>((current_tail + i) % actualSize)]);
+            
+            *parOutput = std::move(message);
+            ++parOutput;
+        }
+        
+        if (count > 0)
+        {
+            tail.store((current_tail + count) % actualSize, std::memory_order_release);
+        }
+        
+        return std::max(count, 0);
+    }
+    
+    template<int N, class T>
+    template<class Range>
+    inline int AtomicRingBuffer<N, T>::pushBatch(Range &&parRange)
+    {
+        const int current_head = head.load(std::memory_order_relaxed);
+        const int current_tail = tail.load(std::memory_order_acquire);
+        const int space        = (N - calculateSize(current_head, current_tail));
+        
+        int count = 0;
+        
+        for (auto it = std::begin(parRange); it != std::end(parRange) && count < space; ++it, ++count)
+        {
+            std::swap(buffer[static_cast<std::size_t>((current_head + count) % actualSize)], *it);
+        }
+        
+        if (count > 0)
+        {
+            head.store((current_head + count) % actualSize, std::memory_order_release);
+        }
+        
+        return count;
+    }
+    
     //==================================================================================================================
     template<int N, class T>
     inline int AtomicRingBuffer<N, T>::size() const noexcept
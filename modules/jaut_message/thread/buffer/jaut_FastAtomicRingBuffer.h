@@ -0,0 +1,309 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+    
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+    
+    @author Elanda
+    @file   jaut_FastAtomicRingBuffer.h
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+
+#pragma once
+
+#include <jaut_core/define/jaut_AssertDef.h>
+
+#include <jaut_core/define/jaut_Define.h>
+#include <jaut_message/thread/message/jaut_IMessageBuffer.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <new>
+
+
+
+/** Config: JAUT_MESSAGE_CACHE_LINE_SIZE
+    
+    The amount of bytes that are assumed to be the size of a cache-line.
+    This is used to keep data that is written by different threads from sharing the same cache-line.
+    If the standard library provides std::hardware_destructive_interference_size, that will be the default,
+    otherwise it will be 64.
+    (GCC is excluded, as it considers the value ABI unstable and warns about every use of it in headers)
+ */
+#ifndef JAUT_MESSAGE_CACHE_LINE_SIZE
+    #if defined(__cpp_lib_hardware_interference_size) && (!defined(__GNUC__) || defined(__clang__))
+        #define JAUT_MESSAGE_CACHE_LINE_SIZE std::hardware_destructive_interference_size
+    #else
+        #define JAUT_MESSAGE_CACHE_LINE_SIZE 64
+    #endif
+#endif
+
+
+
+namespace jaut
+{
+    //==================================================================================================================
+    /**
+     *  A SPSC queue implementation like jaut::AtomicRingBuffer, tuned for high throughput at the cost of some
+     *  flexibility.
+     *  <br><br>
+     *  Other than jaut::AtomicRingBuffer, this buffer:
+     *  - requires BufferSize to be a power of two, so that indices can be wrapped with a bitmask
+     *  - doesn't need an additional slot, as head and tail run freely and are only masked on access
+     *  - keeps head and tail on their own cache-lines, so producer and consumer don't invalidate each other's line
+     *  - caches the opposite index on each side, so that the other side's cache-line only needs to be touched when the
+     *    buffer seemingly ran full or empty
+     *  <br><br>
+     *  Only one thread can push and another can pop.
+     *  
+     *  @tparam BufferSize How much space should be usable, must be a power of two
+     */
+    template<int BufferSize, class T = IMessageBuffer<>::Message>
+    class JAUT_API FastAtomicRingBuffer : public IMessageBuffer<T>
+    {
+    public:
+        static_assert(BufferSize > 0,                       JAUT_ASSERT_ATOMIC_RING_BUFFER_INVALID_CAPACITY);
+        static_assert((BufferSize & (BufferSize - 1)) == 0, JAUT_ASSERT_FAST_RING_BUFFER_NOT_POWER_OF_TWO);
+        
+        //==============================================================================================================
+        /**
+         *  Since head and tail run freely, this buffer doesn't need an additional slot.
+         *  <br><br>
+         *  This will always be "BufferSize".
+         */
+        static constexpr int actualSize = BufferSize;
+        
+        /** Whether this buffer allows pushing messages from more than one thread at the same time. */
+        static constexpr bool multiProducer = false;
+        
+        //==============================================================================================================
+        /** Constructs a new FastAtomicRingBuffer. */
+        FastAtomicRingBuffer() noexcept = default;
+        
+        //==============================================================================================================
+        int push(T message) override;
+        
+        JAUT_NODISCARD
+        T pop() override;
+        
+        //==============================================================================================================
+        /**
+         *  Pops up to the given amount of messages from the buffer and writes them to the output iterator.
+         *  Head and tail will only be touched once for the entire batch.
+         *  
+         *  @param output The output iterator to write the popped messages to
+         *  @param max    The maximum amount of messages to pop
+         *  @return The number of messages that were popped
+         */
+        template<class OutputIt>
+        int popBatch(OutputIt output, int max);
+        
+        /**
+         *  Pushes as many messages from the given range as fit into the buffer.
+         *  Head and tail will only be touched once for the entire batch.
+         *  
+         *  @param range The range of messages to push, the pushed elements will be moved from
+         *  @return The number of messages that were pushed, starting from the beginning of the range
+         */
+        template<class Range>
+        int pushBatch(Range &&range);
+        
+        //==============================================================================================================
+        JAUT_NODISCARD
+        int size() const noexcept override;
+        
+        JAUT_NODISCARD
+        int capacity() const noexcept override;
+        
+        //==============================================================================================================
+        JAUT_NODISCARD
+        bool isFull() const noexcept override;
+        
+        JAUT_NODISCARD
+        bool isEmpty() const noexcept override;
+        
+    private:
+        using Position = std::size_t;
+        
+        //==============================================================================================================
+        static constexpr std::size_t cacheLineSize = JAUT_MESSAGE_CACHE_LINE_SIZE;
+        static constexpr Position    mask          = static_cast<Position>(BufferSize - 1);
+        
+        //==============================================================================================================
+        // Producer side
+        alignas(cacheLineSize) std::atomic<Position> head {};
+        Position cachedTail {};
+        
+        // Consumer side
+        alignas(cacheLineSize) std::atomic<Position> tail {};
+        Position cachedHead {};
+        
+        alignas(cacheLineSize) std::array<T, static_cast<std::size_t>(actualSize)> buffer;
+        
+        //==============================================================================================================
+        JAUT_NODISCARD
+        static int calculateSize(Position head, Position tail) noexcept;
+    };
+    
+    //==================================================================================================================
+    template<int N, class T>
+    inline int FastAtomicRingBuffer<N, T>::push(T parMessage)
+    {
+        const Position current_head = head.load(std::memory_order_relaxed);
+        
+        if ((current_head - cachedTail) >= static_cast<Position>(N))
+        {
+            cachedTail = tail.load(std::memory_order_acquire);
+            
+            if ((current_head - cachedTail) >= static_cast<Position>(N))
+            {
+                return -1;
+            }
+        }
+        
+        std::swap(buffer[current_head & mask], parMessage);
+        head.store(current_head + 1, std::memory_order_release);
+        
+        return calculateSize(current_head, cachedTail);
+    }
+    
+    template<int N, class T>
+    inline T FastAtomicRingBuffer<N, T>::pop()
+    {
+        const Position current_tail = tail.load(std::memory_order_relaxed);
+        
+        if (current_tail == cachedHead)
+        {
+            cachedHead = head.load(std::memory_order_acquire);
+            
+            if (current_tail == cachedHead)
+            {
+                return T{};
+            }
+        }
+        
+        T message {};
+        std::swap(message, buffer[current_tail & mask]);
+        
+        tail.store(current_tail + 1, std::memory_order_release);
+        
+        return message;
+    }
+    
+    //==================================================================================================================
+    template<int N, class T>
+    template<class OutputIt>
+    inline int FastAtomicRingBuffer<N, T>::popBatch(OutputIt parOutput, int parMax)
+    {
+        const Position current_tail = tail.load(std::memory_order_relaxed);
+        cachedHead = head.load(std::memory_order_acquire);
+        
+        const int count = std::min(calculateSize(cachedHead, current_tail), parMax);
+        
+        for (int i = 0; i < count; ++i)
+        {
+            T message {};
+            std::swap(message, buffer[(current_tail + static_cast<Position>(i)) & mask]);
+            
+            *parOutput = std::move(message);
+            ++parOutput;
+        }
+        
+        if (count > 0)
+        {
+            tail.store(current_tail + static_cast<Position>(count), std::memory_order_release);
+        }
+        
+        return std::max(count, 0);
+    }
+    
+    template<int N, class T>
+    template<class Range>
+    inline int FastAtomicRingBuffer<N, T>::pushBatch(Range &&parRange)
+    {
+        const Position current_head = head.load(std::memory_order_relaxed);
+        cachedTail = tail.load(std::memory_order_acquire);
+        
+        const int space = (N - calculateSize(current_head, cachedTail));
+        int       count = 0;
+        
+        for (auto it = std::begin(parRange); it != std::end(parRange) && count < space; ++it, ++count)
+        {
+            std::swap(buffer[(current_head + static_cast<Position>(count)) & mask], *it);
+        }
+        
+        if (count > 0)
+        {
+            head.store(current_head + static_cast<Position>(count), std::memory_order_release);
+        }
+        
+        return count;
+    }
+    
+    //==================================================================================================================
+    template<int N, class T>
+    inline int FastAtomicRingBuffer<N, T>::size() const noexcept
+    {
+        const Position current_tail = tail.load();
+        const Position current_head = head.load();
+        return calculateSize(current_head, current_tail);
+    }
+    
+    template<int N, class T>
+    inline int FastAtomicRingBuffer<N, T>::capacity() const noexcept
+    {
+        return N;
+    }
+    
+    //==================================================================================================================
+    template<int N, class T>
+    inline bool FastAtomicRingBuffer<N, T>::isFull() const noexcept
+    {
+        return (size() >= N);
+    }
+    
+    template<int N, class T>
+    inline bool FastAtomicRingBuffer<N, T>::isEmpty() const noexcept
+    {
+        const Position current_tail = tail.load();
+        const Position current_head = head.load();
+        
+        return (current_head == current_tail);
+    }
+    
+    //==================================================================================================================
+    template<int N, class T>
+    inline int FastAtomicRingBuffer<N, T>::calculateSize(Position parHead, Position parTail) noexcept
+    {
+        // head and tail are loaded independently, so the tail might have overtaken the head we saw
+        const auto distance = static_cast<std::ptrdiff_t>(parHead - parTail);
+        return static_cast<int>(distance < 0 ? 0 : (distance > N ? N : distance));
+    }
+}
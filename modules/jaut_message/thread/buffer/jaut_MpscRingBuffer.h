@@ -0,0 +1,369 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+    
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+    
+    @author Elanda
+    @file   jaut_MpscRingBuffer.h
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+
+#pragma once
+
+#include <jaut_core/define/jaut_AssertDef.h>
+
+#include <jaut_core/define/jaut_Define.h>
+#include <jaut_message/thread/message/jaut_IMessageBuffer.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+
+
+
+namespace jaut
+{
+    //==================================================================================================================
+    /**
+     *  A bounded MPSC queue implementation that allows pushing from any number of threads and popping from one.
+     *  <br><br>
+     *  Every slot carries its own sequence number, so producers only ever compete over the next free position
+     *  and never need a lock to do so.
+     *  A producer claims a slot by advancing the enqueue position, fills it and then publishes it by bumping the slot's
+     *  sequence, the consumer on the other hand only considers slots that have been published.
+     *  <br><br>
+     *  Note that a slot claimed but not yet published will be reported as empty to the consumer until the producer
+     *  finished writing to it, even if slots after it have already been published.
+     *  <br><br>
+     *  If you only ever push from one thread, you are better off with jaut::AtomicRingBuffer.
+     *  
+     *  @tparam BufferSize How much space should be usable
+     */
+    template<int BufferSize, class T = IMessageBuffer<>::Message>
+    class JAUT_API MpscRingBuffer : public IMessageBuffer<T>
+    {
+    public:
+        static_assert(BufferSize > 0, JAUT_ASSERT_MPSC_RING_BUFFER_INVALID_CAPACITY);
+        
+        //==============================================================================================================
+        /**
+         *  Since every slot has its own sequence number, this buffer doesn't need an additional slot.
+         *  <br><br>
+         *  This will always be "BufferSize".
+         */
+        static constexpr int actualSize = BufferSize;
+        
+        /** Whether this buffer allows pushing messages from more than one thread at the same time. */
+        static constexpr bool multiProducer = true;
+        
+        //==============================================================================================================
+        /** Constructs a new MpscRingBuffer. */
+        MpscRingBuffer() noexcept;
+        
+        //==============================================================================================================
+        /**
+         *  Pushes a new message onto the buffer.
+         *  This can safely be called from any number of threads simultaneously.
+         *  
+         *  @param message The message to push
+         *  @return The position the message was enqueued in, -1 if the buffer was full
+         */
+        int push(T message) override;
+        
+        /**
+         *  Pops the next published message from the buffer.
+         *  This must only be called from one thread at a time.
+         *  
+         *  @return The popped message or a default constructed message if there was none
+         */
+        JAUT_NODISCARD
+        T pop() override;
+        
+        //==============================================================================================================
+        /**
+         *  Pops up to the given amount of published messages from the buffer and writes them to the output iterator.
+         *  The tail will only be touched once for the entire batch.
+         *  This must only be called from one thread at a time.
+         *  
+         *  @param output The output iterator to write the popped messages to
+         *  @param max    The maximum amount of messages to pop
+         *  @return The number of messages that were popped
+         */
+        template<class OutputIt>
+        int popBatch(OutputIt output, int max);
+        
+        /**
+         *  Pushes as many messages from the given range as fit into the buffer.
+         *  The slots for the entire batch are claimed at once, so the batch will be enqueued contiguously.
+         *  This can safely be called from any number of threads simultaneously.
+         *  
+         *  @param range The range of messages to push, the pushed elements will be moved from
+         *  @return The number of messages that were pushed, starting from the beginning of the range
+         */
+        template<class Range>
+        int pushBatch(Range &&range);
+        
+        //==============================================================================================================
+        JAUT_NODISCARD
+        int size() const noexcept override;
+        
+        JAUT_NODISCARD
+        int capacity() const noexcept override;
+        
+        //==============================================================================================================
+        JAUT_NODISCARD
+        bool isFull() const noexcept override;
+        
+        JAUT_NODISCARD
+        bool isEmpty() const noexcept override;
+        
+    private:
+        using Position = std::size_t;
+        using Distance = std::ptrdiff_t;
+        
+        struct Slot
+        {
+            std::atomic<Position> sequence;
+            T                     data;
+        };
+        
+        //==============================================================================================================
+        std::array<Slot, static_cast<std::size_t>(actualSize)> buffer;
+        
+        std::atomic<Position> head {};
+        std::atomic<Position> tail {};
+        
+        //==============================================================================================================
+        JAUT_NODISCARD
+        static std::size_t getIndex(Position position) noexcept;
+        
+        JAUT_NODISCARD
+        static int calculateSize(Position head, Position tail) noexcept;
+    };
+    
+    //==================================================================================================================
+    template<int N, class T>
+    inline MpscRingBuffer<N, T>::MpscRingBuffer() noexcept
+    {
+        for (std::size_t i = 0; i < buffer.size(); ++i)
+        {
+            buffer[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    
+    //==================================================================================================================
+    template<int N, class T>
+    inline int MpscRingBuffer<N, T>::push(T parMessage)
+    {
+        Position current_head = head.load(std::memory_order_relaxed);
+        
+        for (;;)
+        {
+            Slot           &slot    = buffer[getIndex(current_head)];
+            const Position sequence = slot.sequence.load(std::memory_order_acquire);
+            const Distance distance = static_cast<Distance>(sequence - current_head);
+            
+            if (distance == 0)
+            {
+                // the slot is free, try to claim it, if another producer was faster current_head gets updated
+                if (head.compare_exchange_weak(current_head, current_head + 1, std::memory_order_relaxed))
+                {
+                    std::swap(slot.data, parMessage);
+                    slot.sequence.store(current_head + 1, std::memory_order_release);
+                    
+                    return calculateSize(current_head, tail.load(std::memory_order_relaxed));
+                }
+            }
+            else if (distance < 0)
+            {
+                // the slot still holds a message from the previous round, the buffer is full
+                return -1;
+            }
+            else
+            {
+                current_head = head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+    
+    template<int N, class T>
+    inline T MpscRingBuffer<N, T>::pop()
+    {
+        const Position current_tail = tail.load(std::memory_order_relaxed);
+        Slot           &slot        = buffer[getIndex(current_tail)];
+        
+        if (slot.sequence.load(std::memory_order_acquire) != (current_tail + 1))
+        {
+            return T{};
+        }
+        
+        T message {};
+        std::swap(message, slot.data);
+        
+        // hand the slot back to the producers for the next round
+        slot.sequence.store(current_tail + static_cast<Position>(actualSize), std::memory_order_release);
+        tail.store(current_tail + 1, std::memory_order_release);
+        
+        return message;
+    }
+    
+    //==================================================================================================================
+    template<int N, class T>
+    template<class OutputIt>
+    inline int MpscRingBuffer<N, T>::popBatch(OutputIt parOutput, int parMax)
+    {
+        const Position current_tail = tail.load(std::memory_order_relaxed);
+        int            count        = 0;
+        
+        for (; count < parMax; ++count)
+        {
+            const Position position = current_tail + static_cast<Position>(count);
+            Slot           &slot    = buffer[getIndex(position)];
+            
+            if (slot.sequence.load(std::memory_order_acquire) != (position + 1))
+            {
+                break;
+            }
+            
+            T message {};
+            std::swap(message, slot.data);
+            
+            slot.sequence.store(position + static_cast<Position>(actualSize), std::memory_order_release);
+            
+            *parOutput = std::move(message);
+            ++parOutput;
+        }
+        
+        if (count > 0)
+        {
+            tail.store(current_tail + static_cast<Position>(count), std::memory_order_release);
+        }
+        
+        return count;
+    }
+    
+    template<int N, class T>
+    template<class Range>
+    inline int MpscRingBuffer<N, T>::pushBatch(Range &&parRange)
+    {
+        const auto range_size = std::distance(std::begin(parRange), std::end(parRange));
+        
+        if (range_size <= 0)
+        {
+            return 0;
+        }
+        
+        Position current_head = head.load(std::memory_order_relaxed);
+        Position count        = 0;
+        
+        for (;;)
+        {
+            const int space = (N - calculateSize(current_head, tail.load(std::memory_order_acquire)));
+            count = std::min(static_cast<Position>(range_size), static_cast<Position>(std::max(space, 0)));
+            
+            if (count == 0)
+            {
+                return 0;
+            }
+            
+            // The consumer frees slots in order, so if the last slot of the batch is free, all before it are too
+            const Position last = current_head + count - 1;
+            
+            if (buffer[getIndex(last)].sequence.load(std::memory_order_acquire) != last)
+            {
+                current_head = head.load(std::memory_order_relaxed);
+                continue;
+            }
+            
+            if (head.compare_exchange_weak(current_head, current_head + count, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        
+        auto it = std::begin(parRange);
+        
+        for (Position i = 0; i < count; ++i, ++it)
+        {
+            Slot &slot = buffer[getIndex(current_head + i)];
+            
+            std::swap(slot.data, *it);
+            slot.sequence.store(current_head + i + 1, std::memory_order_release);
+        }
+        
+        return static_cast<int>(count);
+    }
+    
+    //==================================================================================================================
+    template<int N, class T>
+    inline int MpscRingBuffer<N, T>::size() const noexcept
+    {
+        const Position current_tail = tail.load();
+        const Position current_head = head.load();
+        return calculateSize(current_head, current_tail);
+    }
+    
+    template<int N, class T>
+    inline int MpscRingBuffer<N, T>::capacity() const noexcept
+    {
+        return N;
+    }
+    
+    //==================================================================================================================
+    template<int N, class T>
+    inline bool MpscRingBuffer<N, T>::isFull() const noexcept
+    {
+        return (size() >= N);
+    }
+    
+    template<int N, class T>
+    inline bool MpscRingBuffer<N, T>::isEmpty() const noexcept
+    {
+        const Position current_tail = tail.load(std::memory_order_acquire);
+        const Slot     &slot        = buffer[getIndex(current_tail)];
+        
+        return (slot.sequence.load(std::memory_order_acquire) != (current_tail + 1));
+    }
+    
+    //==================================================================================================================
+    template<int N, class T>
+    inline std::size_t MpscRingBuffer<N, T>::getIndex(Position parPosition) noexcept
+    {
+        return static_cast<std::size_t>(parPosition % static_cast<Position>(actualSize));
+    }
+    
+    template<int N, class T>
+    inline int MpscRingBuffer<N, T>::calculateSize(Position parHead, Position parTail) noexcept
+    {
+        // head and tail are loaded independently, so the tail might have overtaken the head we saw
+        const Distance distance = static_cast<Distance>(parHead - parTail);
+        return static_cast<int>(distance < 0 ? 0 : (distance > N ? N : distance));
+    }
+}
@@ -39,7 +39,9 @@
 #include <jaut_core/define/jaut_Define.h>
 #include <jaut_message/thread/message/jaut_IMessageBuffer.h>
 
+#include <algorithm>
 #include <array>
+#include <iterator>
 
 
 
@@ -69,6 +71,9 @@ namespace jaut
          */
         static constexpr int actualSize = (BufferSize + 1);
         
+        /** Whether this buffer allows pushing messages from more than one thread at the same time. */
+        static constexpr bool multiProducer = false;
+        
         //==============================================================================================================
         /** Constructs a new AtomicRingBuffer. */
         SimpleRingBuffer() noexcept = default;
@@ -79,6 +84,26 @@ namespace jaut
         JAUT_NODISCARD
         T pop() override;
         
+        //==============================================================================================================
+        /**
+         *  Pops up to the given amount of messages from the buffer and writes them to the output iterator.
+         *  
+         *  @param output The output iterator to write the popped messages to
+         *  @param max    The maximum amount of messages to pop
+         *  @return The number of messages that were popped
+         */
+        template<class OutputIt>
+        int popBatch(OutputIt output, int max);
+        
+        /**
+         *  Pushes as many messages from the given range as fit into the buffer.
+         *  
+         *  @param range The range of messages to push, the pushed elements will be moved from
+         *  @return The number of messages that were pushed, starting from the beginning of the range
+         */
+        template<class Range>
+        int pushBatch(Range &&range);
+        
         //==============================================================================================================
         JAUT_NODISCARD
         int size() const noexcept override;
@@ -134,6 +159,42 @@ namespace jaut
         return message;
     }
     
+    //==================================================================================================================
+    template<int N, class T>
+    template<class OutputIt>
+    inline int SimpleRingBuffer<N, T>::popBatch(OutputIt parOutput, int parMax)
+    {
+        const int count = std::min(size(), parMax);
+        
+        for (int i = 0; i < count; ++i)
+        {
+            T message {};
+            std::swap(message, buffer[static_cast<std::size_t>(tail)]);
+            tail = (tail + 1) % actualSize;
+            
+            *parOutput = std::move(message);
+            ++parOutput;
+        }
+        
+        return std::max(count, 0);
+    }
+    
+    template<int N, class T>
+    template<class Range>
+    inline int SimpleRingBuffer<N, T>::pushBatch(Range &&parRange)
+    {
+        const int space = (N - size());
+        int       count = 0;
+        
+        for (auto it = std::begin(parRange); it != std::end(parRange) && count < space; ++it, ++count)
+        {
+            std::swap(buffer[static_cast<std::size_t>(head)], *it);
+            head = (head + 1) % actualSize;
+        }
+        
+        return count;
+    }
+    
     //==================================================================================================================
     template<int N, class T>
     inline int SimpleRingBuffer<N, T>::size() const noexcept
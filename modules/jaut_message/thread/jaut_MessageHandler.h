@@ -367,16 +367,21 @@ namespace jaut
     template<int N, int M>
     inline void MessageHandler<N, M>::timerCallback()
     {
-        WaybackMessage message = backBuffer.pop();
+        std::array<WaybackMessage, static_cast<std::size_t>(M)> batch;
         
-        while (message.message)
+        for (int count; (count = backBuffer.popBatch(batch.begin(), M)) > 0;)
         {
-            if (message.handle)
+            for (int i = 0; i < count; ++i)
             {
-                handleMessage(message.message.get(), MessageDirection::MessageThread);
+                WaybackMessage &message = batch[static_cast<std::size_t>(i)];
+                
+                if (message.handle)
+                {
+                    handleMessage(message.message.get(), MessageDirection::MessageThread);
+                }
+                
+                message.message.reset();
             }
-            
-            message = backBuffer.pop();
         }
     }
     
@@ -425,30 +430,39 @@ namespace jaut
             return;
         }
         
-        while ((parCount--) > 0)
+        std::array<MessagePointer, static_cast<std::size_t>(N)> batch;
+        
+        while (parCount > 0)
         {
-            MessagePointer message = messageBuffer.pop();
+            const int count = messageBuffer.popBatch(batch.begin(), std::min(parCount, N));
             
-            if (!message)
+            if (count == 0)
             {
                 break;
             }
             
-            const bool is_deferred = (message->getDeferId() >= 0);
-            bool       defer       = false;
-            
-            if (!is_deferred)
-            {
-                handleMessage(message.get(), MessageDirection::TargetThread);
-            }
-            else
-            {
-                defer = deferredMessageInitHandler(message.get());
-            }
+            parCount -= count;
             
-            if (options.enableGarbageCollecting || defer)
+            for (int i = 0; i < count; ++i)
             {
-                backBuffer.push({ defer, std::move(message) });
+                MessagePointer message = std::move(batch[static_cast<std::size_t>(i)]);
+                
+                const bool is_deferred = (message->getDeferId() >= 0);
+                bool       defer       = false;
+                
+                if (!is_deferred)
+                {
+                    handleMessage(message.get(), MessageDirection::TargetThread);
+                }
+                else
+                {
+                    defer = deferredMessageInitHandler(message.get());
+                }
+                
+                if (options.enableGarbageCollecting || defer)
+                {
+                    backBuffer.push({ defer, std::move(message) });
+                }
             }
         }
     }
@@ -38,6 +38,8 @@
 #include <jaut_core/util/jaut_CommonUtils.h>
 #include <jaut_message/thread/message/jaut_IMessage.h>
 
+#include <type_traits>
+
 
 
 namespace jaut
@@ -101,5 +103,97 @@ namespace jaut
          */
         JAUT_NODISCARD
         virtual int capacity() const = 0;
+        
+        //==============================================================================================================
+        /**
+         *  Pops up to the given amount of messages from the buffer and writes them to the output iterator.
+         *  <br><br>
+         *  This is a generic fallback built on top of pop(), buffers that can do better are supposed to hide this
+         *  with their own implementation.
+         *  Since this is not virtual, only calls through the concrete buffer type will get to benefit from that.
+         *  
+         *  @param output The output iterator to write the popped messages to
+         *  @param max    The maximum amount of messages to pop
+         *  @return The number of messages that were popped
+         */
+        template<class OutputIt>
+        int popBatch(OutputIt output, int max);
+        
+        /**
+         *  Pushes as many messages from the given range as fit into the buffer.
+         *  The elements that could be pushed will be moved from.
+         *  <br><br>
+         *  This is a generic fallback built on top of push(), buffers that can do better are supposed to hide this
+         *  with their own implementation.
+         *  Since this is not virtual, only calls through the concrete buffer type will get to benefit from that.
+         *  <br><br>
+         *  The fallback checks isFull() before moving an element into push(), so it only keeps its promise to leave
+         *  the elements that weren't pushed untouched as long as no other thread pushes at the same time.
+         *  
+         *  @param range The range of messages to push
+         *  @return The number of messages that were pushed, starting from the beginning of the range
+         */
+        template<class Range>
+        int pushBatch(Range &&range);
     };
+    
+    //==================================================================================================================
+    // IMPLEMENTATION
+    template<class T>
+    template<class OutputIt>
+    inline int IMessageBuffer<T>::popBatch(OutputIt parOutput, int parMax)
+    {
+        int count = 0;
+        
+        for (; count < parMax && !isEmpty(); ++count)
+        {
+            *parOutput = pop();
+            ++parOutput;
+        }
+        
+        return count;
+    }
+    
+    template<class T>
+    template<class Range>
+    inline int IMessageBuffer<T>::pushBatch(Range &&parRange)
+    {
+        int count = 0;
+        
+        for (auto &message : parRange)
+        {
+            // push() takes the message by value, so it would already be moved from if the push failed
+            if (isFull() || push(std::move(message)) < 0)
+            {
+                break;
+            }
+            
+            ++count;
+        }
+        
+        return count;
+    }
+    
+    //==================================================================================================================
+    /**
+     *  Checks whether a message buffer allows pushing messages from more than one thread at the same time.<br>
+     *  This reads the static multiProducer member of the buffer, buffers that don't declare one are assumed to
+     *  only allow a single producer.
+     *  
+     *  @tparam Buffer The buffer type to check
+     */
+    template<class Buffer, class = std::void_t<>>
+    struct JAUT_API isMultiProducerBuffer : std::false_type {};
+    
+    template<class Buffer>
+    struct JAUT_API isMultiProducerBuffer<Buffer, std::void_t<decltype(Buffer::multiProducer)>>
+        : std::bool_constant<static_cast<bool>(Buffer::multiProducer)>
+    {};
+    
+    /**
+     *  Checks whether a message buffer allows pushing messages from more than one thread at the same time.
+     *  @tparam Buffer The buffer type to check
+     */
+    template<class Buffer>
+    JAUT_API inline constexpr bool isMultiProducerBuffer_v = isMultiProducerBuffer<Buffer>::value;
 }
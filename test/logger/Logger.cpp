@@ -32,15 +32,33 @@
     ===============================================================
  */
 
+// Trace calls through the JAUT_LOG macros should be compiled out for this suite
+#define JAUT_LOGGER_MIN_LEVEL Debug
+
+// The workers and sinks should collect metrics for this suite
+#define JAUT_LOGGER_METRICS 1
+
 #include <jaut_logger/jaut_AbstractLogger.cpp>
+#include <jaut_logger/jaut_LogClock.cpp>
+#include <jaut_logger/jaut_LogMetrics.cpp>
+#include <jaut_logger/jaut_LogRecord.cpp>
+#include <jaut_logger/jaut_LogSymbol.cpp>
 #include <jaut_logger/jaut_BasicLogger.h>
 #include <jaut_logger/format/jaut_LogFormatCallback.cpp>
 #include <jaut_logger/sink/jaut_LogSinkOstream.h>
+#include <jaut_logger/worker/jaut_LogRunMerger.h>
+#include <jaut_logger/worker/jaut_LogWorkerThreaded.cpp>
 
 #include <jaut_core/util/jaut_CommonUtils.h>
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <deque>
+#include <string_view>
+#include <thread>
+#include <vector>
+
 
 
 //**********************************************************************************************************************
@@ -76,7 +94,45 @@ namespace
     //******************************************************************************************************************
     // region Testing Facilities
     //==================================================================================================================
+    /** A user-supplied buffer that doesn't say whether it allows several producers. */
+    template<int BufferSize, class T>
+    class DequeBuffer : public jaut::IMessageBuffer<T>
+    {
+    public:
+        int push(T message) override
+        {
+            if (isFull())
+            {
+                return -1;
+            }
+            
+            queue.push_back(std::move(message));
+            return static_cast<int>(queue.size() - 1);
+        }
+        
+        T pop() override
+        {
+            if (isEmpty())
+            {
+                return T{};
+            }
+            
+            T message = std::move(queue.front());
+            queue.pop_front();
+            
+            return message;
+        }
+        
+        //==============================================================================================================
+        bool isEmpty()  const override { return queue.empty(); }
+        bool isFull()   const override { return (size() >= BufferSize); }
+        int  size()     const override { return static_cast<int>(queue.size()); }
+        int  capacity() const override { return BufferSize; }
     
+    private:
+        std::deque<T> queue;
+    };
+
     //==================================================================================================================
     // endregion Testing Facilities
     //******************************************************************************************************************
@@ -227,8 +283,776 @@ TEST(LoggerTest, TestLogMethods)
                      "error",
                      std::runtime_error("TEST EXCEPTION UH OH"));
         LOG_TYPE_TEST("Here is some error message: TEST EXCEPTION UH OH")
+        
+        // with compiled format string
+        logger.info(JAUT_FMT("Test {} nr {}"), "object", 1);
+        LOG_TYPE_TEST("Test object nr 1")
+        
+        // with compiled format string and field
+        logger.warn(JAUT_FMT("Testing {} {}:"), 1, jaut::mfield("test", "Hello world!"), "field");
+        LOG_TYPE_TEST("Testing 1 field: Hello world!")
+    }
+}
+
+TEST(LoggerTest, TestLogMacros)
+{
+    std::stringstream stream;
+    
+    jaut::LoggerSimple::Options options;
+    options.onUnexpectedThrow = ::onThrow;
+    options.logLevel          = jaut::LogLevel::Info;
+    
+    jaut::LoggerSimple logger("MACROS", std::move(options),
+                              std::make_unique<jaut::LogSinkOstream<>>(
+                                  stream,
+                                  std::make_unique<jaut::LogFormatCallback>([](const jaut::LogMessage &msg)
+                                  {
+                                      return msg.message;
+                                  })));
+    
+    int evaluations = 0;
+    const auto count = [&evaluations]() { return ++evaluations; };
+    
+    // below the logger level, arguments must not be evaluated
+    JAUT_LOG_DEBUG(logger, "Test {}", count());
+    LOG_TYPE_TEST("")
+    EXPECT_EQ(evaluations, 0);
+    
+    JAUT_LOG_INFO(logger, "Test {}", count());
+    LOG_TYPE_TEST("Test 1")
+    
+    JAUT_LOG_ERROR(logger, JAUT_FMT("Test {}"), count());
+    LOG_TYPE_TEST("Test 2")
+    
+    // lowering the level at runtime enables them again
+    logger.setLogLevel(jaut::LogLevel::Trace);
+    
+    JAUT_LOG_DEBUG(logger, "Test {}", count());
+    LOG_TYPE_TEST("Test 3")
+    
+    // but trace is below JAUT_LOGGER_MIN_LEVEL and was compiled out
+    JAUT_LOG_TRACE(logger, "Test {}", count());
+    LOG_TYPE_TEST("")
+    EXPECT_EQ(evaluations, 3);
+    
+    // the builder at Off shouldn't log either
+    logger.setLogLevel(jaut::LogLevel::Off);
+    logger << jaut::LogLevel::Fatal << "Test";
+    LOG_TYPE_TEST("")
+}
+
+TEST(LoggerTest, TestDeferredLog)
+{
+    std::stringstream stream;
+    
+    const auto make_sink = [&stream]()
+    {
+        return std::make_unique<jaut::LogSinkOstream<>>(
+            stream,
+            std::make_unique<jaut::LogFormatCallback>([](const jaut::LogMessage &msg)
+            {
+                return msg.message + (msg.threadName.isEmpty() ? "" : " @" + msg.threadName.toString()) + '\n';
+            }));
+    };
+    
+    // deferred on a worker that can't handle records, should be rendered right away
+    {
+        jaut::LoggerSimple::Options options;
+        options.onUnexpectedThrow = ::onThrow;
+        
+        jaut::LoggerSimple logger("DEFERRED_SIMPLE", std::move(options), make_sink());
+        
+        logger.logDeferred(jaut::LogLevel::Info, JAUT_FMT("Test {} nr {:.1f}"), 1, 2.5);
+        LOG_TYPE_TEST("Test 1 nr 2.5\n")
+        
+        // arguments that can't be deferred
+        logger.logDeferred(jaut::LogLevel::Info, JAUT_FMT("Test {}"), juce::String("object"));
+        LOG_TYPE_TEST("Test object\n")
+    }
+    
+    // deferred on a worker that renders records on its own thread
+    {
+        jaut::LoggerDeferred::Options options;
+        options.onUnexpectedThrow                       = ::onThrow;
+        options.flushPolicySettings.flushOnFinalisation = true;
+        options.flushPolicySettings.policies.reset();
+        
+        {
+            jaut::LoggerDeferred logger("DEFERRED", std::move(options), make_sink());
+            
+            logger.logDeferred(jaut::LogLevel::Info, JAUT_FMT("Test {} nr {}"), 1, 2);
+            logger.info("Test {}", "eager");
+            logger.logDeferred(jaut::LogLevel::Info, JAUT_FMT("Test {}"), juce::String("object"));
+            logger.logDeferred(jaut::LogLevel::Trace, JAUT_FMT("Filtered {}"), 3);
+        }
+        
+        LOG_TYPE_TEST("Test 1 nr 2\nTest eager\nTest object\n")
+    }
+}
+
+TEST(LoggerTest, TestDeferredDanglingArguments)
+{
+    enum class Colour { Red, Green };
+    
+    struct Reference
+    {
+        const char *text;
+    };
+    
+    // Only plain values may be copied into a record, anything that refers to memory must be formatted eagerly
+    static_assert( jaut::LogRecord::canDefer<int, double, bool, char, Colour>);
+    static_assert(!jaut::LogRecord::canDefer<std::string_view>);
+    static_assert(!jaut::LogRecord::canDefer<fmt::string_view>);
+    static_assert(!jaut::LogRecord::canDefer<juce::StringRef>);
+    static_assert(!jaut::LogRecord::canDefer<const char*>);
+    static_assert(!jaut::LogRecord::canDefer<Reference>);
+    
+    std::stringstream stream;
+    
+    {
+        jaut::LoggerDeferred::Options options;
+        options.onUnexpectedThrow                       = ::onThrow;
+        options.flushPolicySettings.flushOnFinalisation = true;
+        options.flushPolicySettings.policies.reset();
+        
+        jaut::LoggerDeferred logger("DEFERRED_VIEW", std::move(options), std::make_unique<jaut::LogSinkOstream<>>(
+            stream,
+            std::make_unique<jaut::LogFormatCallback>([](const jaut::LogMessage &msg)
+            {
+                return msg.message + '\n';
+            })));
+        
+        {
+            auto text = std::make_unique<std::string>("still here");
+            logger.logDeferred(jaut::LogLevel::Info, JAUT_FMT("View {}"), std::string_view(*text));
+            
+            // Scribble over the buffer before freeing it, so a deferred view would show garbage even without ASan
+            std::fill(text->begin(), text->end(), 'x');
+        }
+        
+        // Nothing has been flushed yet, the record is rendered when the logger is destroyed
+        EXPECT_TRUE(stream.str().empty());
     }
+    
+    EXPECT_EQ(prepString(stream.str()), "View still here\n");
 }
+
+TEST(LoggerTest, TestParallelLog)
+{
+    using Worker = jaut::LogWorkerParallel<512, juce::DummyCriticalSection, jaut::MpscRingBuffer>;
+    
+    std::stringstream stream_fast;
+    std::stringstream stream_slow;
+    
+    const auto make_sink = [](std::stringstream &stream, int delay)
+    {
+        return std::make_unique<jaut::LogSinkOstream<>>(
+            stream,
+            std::make_unique<jaut::LogFormatCallback>([delay](const jaut::LogMessage &msg)
+            {
+                juce::Thread::sleep(delay);
+                return msg.message + '\n';
+            }));
+    };
+    
+    juce::String  expected;
+    std::uint64_t slow_processed = 0;
+    
+    {
+        jaut::LoggerParallelMT::Options options;
+        options.onUnexpectedThrow = ::onThrow;
+        
+        jaut::LoggerParallelMT logger("PARALLEL", std::move(options), make_sink(stream_fast, 0),
+                                      make_sink(stream_slow, 5));
+        
+        for (int i = 0; i < 20; ++i)
+        {
+            logger.info("Parallel {}", i);
+            expected << "Parallel " << i << '\n';
+        }
+        
+        logger.flush();
+        
+        const Worker &worker = static_cast<const Worker&>(logger.getWorker());
+        ASSERT_EQ(worker.getNumLanes(), 2);
+        
+        // Every lane works on its own, so we have to wait for both to catch up
+        const juce::uint32 start = juce::Time::getMillisecondCounter();
+        
+        while (   (worker.getLaneStatistics(0).processedMessages + worker.getLaneStatistics(0).droppedMessages) < 20
+               || (worker.getLaneStatistics(1).processedMessages + worker.getLaneStatistics(1).droppedMessages) < 20)
+        {
+            ASSERT_LT(juce::Time::getMillisecondCounter() - start, 5000u);
+            juce::Thread::sleep(1);
+        }
+        
+        // The fast lane can't have been held back by the slow one
+        EXPECT_EQ(worker.getLaneStatistics(0).droppedMessages, 0u);
+        EXPECT_EQ(worker.getLaneStatistics(0).processedMessages, 20u);
+        
+        slow_processed = worker.getLaneStatistics(1).processedMessages;
+    }
+    
+    EXPECT_EQ(prepString(stream_fast.str()), expected);
+    
+    // The slow lane may have dropped batches, but whatever it printed must have been counted
+    const std::string slow_output = stream_slow.str();
+    EXPECT_EQ(static_cast<std::uint64_t>(std::count(slow_output.begin(), slow_output.end(), '\n')), slow_processed);
+}
+
+TEST(LoggerTest, TestParallelLaneDrop)
+{
+    // A lane can only hold a single batch, so a stuck sink has to drop everything after that
+    using Worker = jaut::LogWorkerParallel<16, juce::DummyCriticalSection, jaut::MpscRingBuffer, 1>;
+    using Logger = jaut::BasicLogger<Worker>;
+    
+    constexpr int num_batches = 10;
+    
+    std::stringstream stream_fast;
+    std::stringstream stream_slow;
+    std::atomic<bool> released { false };
+    
+    juce::String         expected;
+    jaut::LaneStatistics fast_stats;
+    jaut::LaneStatistics slow_stats;
+    
+    {
+        Logger::Options options;
+        options.onUnexpectedThrow = ::onThrow;
+        
+        Logger logger("PARALLEL_DROP", std::move(options),
+            std::make_unique<jaut::LogSinkOstream<>>(
+                stream_fast,
+                std::make_unique<jaut::LogFormatCallback>([](const jaut::LogMessage &msg)
+                {
+                    return msg.message + '\n';
+                })),
+            std::make_unique<jaut::LogSinkOstream<>>(
+                stream_slow,
+                std::make_unique<jaut::LogFormatCallback>([&released](const jaut::LogMessage &msg)
+                {
+                    while (!released)
+                    {
+                        juce::Thread::sleep(1);
+                    }
+                    
+                    return msg.message + '\n';
+                })));
+        
+        const Worker &worker = static_cast<const Worker&>(logger.getWorker());
+        ASSERT_EQ(worker.getNumLanes(), 2);
+        
+        const juce::uint32 start = juce::Time::getMillisecondCounter();
+        
+        for (int i = 0; i < num_batches; ++i)
+        {
+            logger.info("Batch {}", i);
+            logger.flush();
+            expected << "Batch " << i << '\n';
+            
+            // Wait for every batch to reach the fast lane, so that each one is handed to the lanes on its own
+            while (worker.getLaneStatistics(0).processedMessages < static_cast<std::uint64_t>(i + 1))
+            {
+                ASSERT_LT(juce::Time::getMillisecondCounter() - start, 5000u);
+                juce::Thread::sleep(1);
+            }
+        }
+        
+        // At most one batch is stuck in the sink and one is waiting in the queue, the rest must have been dropped
+        while (worker.getLaneStatistics(1).droppedBatches < static_cast<std::uint64_t>(num_batches - 2))
+        {
+            ASSERT_LT(juce::Time::getMillisecondCounter() - start, 5000u);
+            juce::Thread::sleep(1);
+        }
+        
+        fast_stats = worker.getLaneStatistics(0);
+        slow_stats = worker.getLaneStatistics(1);
+        
+        released = true;
+    }
+    
+    EXPECT_EQ(fast_stats.processedMessages, static_cast<std::uint64_t>(num_batches));
+    EXPECT_EQ(fast_stats.droppedMessages, 0u);
+    EXPECT_EQ(fast_stats.droppedBatches,  0u);
+    EXPECT_EQ(prepString(stream_fast.str()), expected);
+    
+    EXPECT_GT(slow_stats.droppedBatches, 0u);
+    EXPECT_EQ(slow_stats.droppedMessages, slow_stats.droppedBatches);
+    EXPECT_EQ(slow_stats.processedMessages, 0u);
+    
+    // Whatever wasn't dropped is printed once the sink is unblocked and the lane drains on finalisation
+    const std::string slow_output = stream_slow.str();
+    EXPECT_EQ(static_cast<std::uint64_t>(std::count(slow_output.begin(), slow_output.end(), '\n')),
+              static_cast<std::uint64_t>(num_batches) - slow_stats.droppedBatches);
+}
+
+TEST(LoggerTest, TestThreadLocalLog)
+{
+    using Logger = jaut::LoggerSimpleTLCS<8>;
+    using Worker = jaut::LogWorkerThreadLocal<8>;
+    
+    constexpr int num_threads  = 4;
+    constexpr int num_messages = 200;
+    
+    std::stringstream stream;
+    
+    {
+        Logger::Options options;
+        options.onUnexpectedThrow                       = ::onThrow;
+        options.overflowPolicySettings.policy           = jaut::OverflowPolicy::Block;
+        options.flushPolicySettings.flushOnFinalisation = true;
+        options.flushPolicySettings.policies.reset();
+        options.flushPolicySettings.policies.set(jaut::FlushPolicy::Filled);
+        
+        Logger logger("THREAD_LOCAL", std::move(options), std::make_unique<jaut::LogSinkOstream<>>(
+            stream,
+            std::make_unique<jaut::LogFormatCallback>([](const jaut::LogMessage &msg)
+            {
+                return msg.message + '\n';
+            })));
+        
+        std::vector<std::thread> producers;
+        
+        for (int p = 0; p < num_threads; ++p)
+        {
+            producers.emplace_back([&logger, p]()
+            {
+                for (int i = 1; i <= num_messages; ++i)
+                {
+                    logger.info("{} {}", p, i);
+                }
+            });
+        }
+        
+        for (std::thread &producer : producers)
+        {
+            producer.join();
+        }
+        
+        // A flush may already have released the lanes of the threads that finished first
+        const Worker &worker = static_cast<const Worker&>(logger.getWorker());
+        EXPECT_LE(worker.getNumLanes(), num_threads);
+        
+        // Whatever is still left in the lanes of the threads has to be written when the logger is destroyed
+    }
+    
+    // Messages of one thread must arrive in the order they were logged, without any of them missing
+    std::vector<int> last_received(num_threads, 0);
+    int              received = 0;
+    
+    int producer = 0;
+    int message  = 0;
+    
+    while (stream >> producer >> message)
+    {
+        ASSERT_GE(producer, 0);
+        ASSERT_LT(producer, num_threads);
+        ASSERT_EQ(message, last_received[static_cast<std::size_t>(producer)] + 1);
+        
+        last_received[static_cast<std::size_t>(producer)] = message;
+        ++received;
+    }
+    
+    EXPECT_EQ(received, num_threads * num_messages);
+}
+
+TEST(LoggerTest, TestThreadLocalLanes)
+{
+    using Logger = jaut::LoggerSimpleTLCS<8>;
+    using Worker = jaut::LogWorkerThreadLocal<8>;
+    
+    constexpr int num_rounds   = 50;
+    constexpr int num_threads  = 4;
+    constexpr int num_messages = 5;
+    
+    std::stringstream stream;
+    
+    {
+        Logger::Options options;
+        options.onUnexpectedThrow = ::onThrow;
+        options.flushPolicySettings.policies.reset();
+        options.flushPolicySettings.policies.set(jaut::FlushPolicy::Filled);
+        
+        Logger logger("THREAD_LOCAL_LANES", std::move(options), std::make_unique<jaut::LogSinkOstream<>>(
+            stream,
+            std::make_unique<jaut::LogFormatCallback>([](const jaut::LogMessage &msg)
+            {
+                return msg.message + '\n';
+            })));
+        
+        const Worker &worker = static_cast<const Worker&>(logger.getWorker());
+        
+        // Like a thread pool that keeps replacing its threads, every round logs from threads that are new
+        for (int r = 0; r < num_rounds; ++r)
+        {
+            std::vector<std::thread> producers;
+            
+            for (int p = 0; p < num_threads; ++p)
+            {
+                producers.emplace_back([&logger]()
+                {
+                    for (int i = 0; i < num_messages; ++i)
+                    {
+                        logger.info("{}", i);
+                    }
+                });
+            }
+            
+            for (std::thread &producer : producers)
+            {
+                producer.join();
+            }
+            
+            logger.flush();
+            
+            // All threads have exited, so the flush must have released their lanes
+            ASSERT_EQ(worker.getNumLanes(), 0);
+        }
+    }
+    
+    // Whatever was left in the lanes of the exited threads must not have been lost
+    const std::string output = stream.str();
+    EXPECT_EQ(std::count(output.begin(), output.end(), '\n'), num_rounds * num_threads * num_messages);
+}
+
+TEST(LoggerTest, TestOverflowPolicies)
+{
+    using Logger = jaut::LoggerSimpleCS<4>;
+    
+    std::stringstream stream;
+    
+    const auto make_options = [](jaut::OverflowPolicy::Value policy)
+    {
+        Logger::Options options;
+        options.onUnexpectedThrow                       = ::onThrow;
+        options.flushPolicySettings.flushOnFinalisation = true;
+        options.flushPolicySettings.policies.reset();
+        options.overflowPolicySettings.policy           = policy;
+        options.overflowPolicySettings.sampleRate       = 0.0;
+        
+        return options;
+    };
+    
+    const auto make_sink = [&stream]()
+    {
+        return std::make_unique<jaut::LogSinkOstream<>>(
+            stream,
+            std::make_unique<jaut::LogFormatCallback>([](const jaut::LogMessage &msg)
+            {
+                return msg.message + '\n';
+            }));
+    };
+    
+    jaut::OverflowPolicy::Statistics statistics;
+    
+    // drop newest, the first messages stay
+    {
+        Logger logger("DROP_NEWEST", make_options(jaut::OverflowPolicy::DropNewest), make_sink());
+        
+        for (int i = 0; i < 10; ++i)
+        {
+            logger.info("{}", i);
+        }
+        
+        statistics = logger.getOverflowStatistics();
+    }
+    
+    LOG_TYPE_TEST("0\n1\n2\n3\n")
+    EXPECT_EQ(statistics.droppedNewest,     6u);
+    EXPECT_EQ(statistics.getTotalDropped(), 6u);
+    
+    // drop oldest, the last messages stay
+    {
+        Logger logger("DROP_OLDEST", make_options(jaut::OverflowPolicy::DropOldest), make_sink());
+        
+        for (int i = 0; i < 10; ++i)
+        {
+            logger.info("{}", i);
+        }
+        
+        statistics = logger.getOverflowStatistics();
+    }
+    
+    LOG_TYPE_TEST("6\n7\n8\n9\n")
+    EXPECT_EQ(statistics.droppedOldest,     6u);
+    EXPECT_EQ(statistics.getTotalDropped(), 6u);
+    
+    // block, nothing gets lost
+    {
+        Logger logger("BLOCK", make_options(jaut::OverflowPolicy::Block), make_sink());
+        
+        for (int i = 0; i < 10; ++i)
+        {
+            logger.info("{}", i);
+        }
+        
+        statistics = logger.getOverflowStatistics();
+    }
+    
+    LOG_TYPE_TEST("0\n1\n2\n3\n4\n5\n6\n7\n8\n9\n")
+    EXPECT_EQ(statistics.blocked,           2u);
+    EXPECT_EQ(statistics.getTotalDropped(), 0u);
+    
+    // sample, errors are never dropped
+    {
+        Logger logger("SAMPLE", make_options(jaut::OverflowPolicy::Sample), make_sink());
+        
+        for (int i = 0; i < 7; ++i)
+        {
+            logger.info("{}", i);
+        }
+        
+        logger.error("Error");
+        statistics = logger.getOverflowStatistics();
+    }
+    
+    LOG_TYPE_TEST("0\n1\n2\n3\nError\n")
+    EXPECT_EQ(statistics.sampledOut,        3u);
+    EXPECT_EQ(statistics.blocked,           1u);
+    EXPECT_EQ(statistics.getTotalDropped(), 3u);
+}
+
+TEST(LoggerTest, TestLogHistogram)
+{
+    jaut::LogHistogram histogram;
+    
+    EXPECT_EQ(histogram.getCount(),                0u);
+    EXPECT_EQ(histogram.getValueAtPercentile(50), 0u);
+    
+    for (std::uint64_t i = 1; i <= 1000; ++i)
+    {
+        histogram.record(i);
+    }
+    
+    EXPECT_EQ(histogram.getCount(), 1000u);
+    EXPECT_EQ(histogram.getMax(),   1000u);
+    EXPECT_DOUBLE_EQ(histogram.getMean(), 500.5);
+    
+    // Buckets are only precise to an eighth of their power of two
+    const auto expect_near = [&histogram](double percentile, std::uint64_t expected)
+    {
+        const std::uint64_t value = histogram.getValueAtPercentile(percentile);
+        EXPECT_LE(value, expected);
+        EXPECT_GE(value, expected - expected / 8);
+    };
+    
+    expect_near(50.0,  500);
+    expect_near(99.0,  990);
+    expect_near(100.0, 1000);
+    
+    for (std::uint64_t value : { 0ull, 7ull, 8ull, 1000ull, 123456789ull, ~0ull })
+    {
+        const int index = jaut::LogHistogram::getBucketIndex(value);
+        
+        ASSERT_LT(index, jaut::LogHistogram::numBuckets);
+        EXPECT_LE(jaut::LogHistogram::getBucketValue(index), value);
+        
+        if (index + 1 < jaut::LogHistogram::numBuckets)
+        {
+            EXPECT_GT(jaut::LogHistogram::getBucketValue(index + 1), value);
+        }
+    }
+    
+    histogram.reset();
+    EXPECT_EQ(histogram.getCount(), 0u);
+}
+
+TEST(LoggerTest, TestMetrics)
+{
+    std::stringstream stream;
+    
+    jaut::LoggerAsync::Options options;
+    options.onUnexpectedThrow = ::onThrow;
+    options.flushPolicySettings.policies.reset();
+    
+    jaut::LoggerAsync logger("METRICS", std::move(options), std::make_unique<jaut::LogSinkOstream<>>(
+        stream,
+        std::make_unique<jaut::LogFormatCallback>([](const jaut::LogMessage &msg)
+        {
+            return msg.message + '\n';
+        })));
+    
+    const jaut::LogWorkerMetrics *worker_metrics = logger.getWorker().getMetrics();
+    const jaut::LogSinkMetrics   *sink_metrics   = logger.getSinks().front()->getMetrics();
+    
+    ASSERT_NE(worker_metrics, nullptr);
+    ASSERT_NE(sink_metrics,   nullptr);
+    
+    for (int i = 0; i < 10; ++i)
+    {
+        logger.info("Metrics {}", i);
+    }
+    
+    EXPECT_EQ(worker_metrics->enqueueLatency.getCount(), 10u);
+    EXPECT_EQ(worker_metrics->highWaterMark.load(),      10);
+    EXPECT_EQ(worker_metrics->overflows.load(),          0u);
+    
+    logger.flush();
+    
+    // The metrics are read while the worker-thread is printing, just like one would from a monitoring thread
+    const juce::uint32 start = juce::Time::getMillisecondCounter();
+    
+    while (sink_metrics->messages.load() < 10 || sink_metrics->writeTime.getCount() == 0)
+    {
+        ASSERT_LT(juce::Time::getMillisecondCounter() - start, 5000u);
+        juce::Thread::sleep(1);
+    }
+    
+    EXPECT_EQ(sink_metrics->formatTime.getCount(),    10u);
+    EXPECT_EQ(worker_metrics->batchSize.getCount(),   1u);
+    EXPECT_EQ(worker_metrics->batchSize.getMax(),     10u);
+}
+
+TEST(LoggerTest, TestLogSymbols)
+{
+    EXPECT_EQ(jaut::LogSymbolTable::intern(""), 0u);
+    EXPECT_TRUE(jaut::LogSymbol().isEmpty());
+    EXPECT_TRUE(jaut::LogSymbol("").isEmpty());
+    
+    const jaut::LogSymbol symbol("symbol-test");
+    EXPECT_TRUE(symbol.isNotEmpty());
+    EXPECT_EQ(symbol.toString(), "symbol-test");
+    EXPECT_EQ(symbol, jaut::LogSymbol(juce::String("symbol-test")));
+    EXPECT_NE(symbol, jaut::LogSymbol("symbol-test-2"));
+    
+    // Symbols interned on another thread resolve to the same id
+    std::uint32_t other_id = 0;
+    std::thread([&other_id]() { other_id = jaut::LogSymbolTable::intern("symbol-test"); }).join();
+    EXPECT_EQ(other_id, symbol.getId());
+    
+    EXPECT_TRUE(jaut::LogSymbolTable::resolve(jaut::LogSymbolTable::getNumSymbols()).isEmpty());
+    
+    // Fields with the same key share their name
+    EXPECT_EQ(jaut::mfield("key", 1).name, jaut::mfield("key", 2).name);
+    EXPECT_EQ(jaut::mfield("key", 1).name.toString(), "fd_key");
+    
+    std::stringstream stream;
+    
+    jaut::LoggerSimple::Options options;
+    options.onUnexpectedThrow = ::onThrow;
+    
+    jaut::LoggerSimple logger("SYMBOLS", std::move(options), std::make_unique<jaut::LogSinkOstream<>>(
+        stream,
+        std::make_unique<jaut::LogFormatCallback>([](const jaut::LogMessage &msg)
+        {
+            return msg.name.toString() + ": " + msg.message + '\n';
+        })
+    ));
+    
+    EXPECT_EQ(logger.getNameSymbol(), jaut::LogSymbol("SYMBOLS"));
+    
+    logger.info("Interned");
+    logger.flush();
+    
+    LOG_TYPE_TEST("SYMBOLS: Interned\n")
+}
+
+TEST(LoggerTest, TestLogThreadTable)
+{
+    std::uint32_t   first_index = 0;
+    std::thread::id first_id;
+    
+    std::thread([&first_index, &first_id]()
+    {
+        first_index = jaut::LogThreadTable::getCurrentThreadIndex();
+        first_id    = std::this_thread::get_id();
+    }).join();
+    
+    // Records of a thread that has exited can still be resolved until its slot is reused
+    EXPECT_EQ(jaut::LogThreadTable::getThread(first_index).threadId, first_id);
+    
+    // Short-lived threads hand their slots over to the threads that come after them
+    for (int i = 0; i < 256; ++i)
+    {
+        std::thread([]() { (void) jaut::LogThreadTable::getCurrentThreadIndex(); }).join();
+    }
+    
+    // Once the slot was reused, the old index must not resolve to the new thread
+    EXPECT_EQ(jaut::LogThreadTable::getThread(first_index).threadId, std::thread::id());
+    
+    const std::uint32_t index = jaut::LogThreadTable::getCurrentThreadIndex();
+    EXPECT_EQ(jaut::LogThreadTable::getThread(index).threadId, std::this_thread::get_id());
+    EXPECT_EQ(jaut::LogThreadTable::getCurrentThread().threadId, std::this_thread::get_id());
+}
+
+TEST(LoggerTest, TestLogClock)
+{
+    jaut::LogClock::resync();
+    
+    const juce::int64 before = juce::Time::currentTimeMillis();
+    const juce::int64 now    = jaut::LogClock::nowMillis();
+    const juce::int64 after  = juce::Time::currentTimeMillis();
+    
+    // The clock may be off by the time it took to capture the offset
+    EXPECT_GE(now, before - 5);
+    EXPECT_LE(now, after  + 5);
+    
+    EXPECT_LE(now, jaut::LogClock::now().toMilliseconds());
+}
+
+TEST(LoggerTest, TestRunMerger)
+{
+    const auto make_message = [](const char *text, juce::int64 time)
+    {
+        jaut::LogMessage message;
+        message.message   = text;
+        message.timestamp = juce::Time(time);
+        
+        return message;
+    };
+    
+    std::vector<std::vector<jaut::LogMessage>> runs(3);
+    runs[0] = { make_message("a", 1), make_message("d", 4), make_message("f", 4) };
+    runs[2] = { make_message("b", 2), make_message("g", 4), make_message("h", 9) };
+    runs[1] = { make_message("c", 3), make_message("e", 4) };
+    
+    std::vector<jaut::LogMessage> merged;
+    
+    jaut::LogRunMerger merger;
+    merger.merge(runs, std::back_inserter(merged), [](const jaut::LogMessage &left, const jaut::LogMessage &right)
+    {
+        return (left.timestamp < right.timestamp);
+    });
+    
+    juce::String order;
+    
+    for (const jaut::LogMessage &message : merged)
+    {
+        order << message.message;
+    }
+    
+    // Equal timestamps are taken from the runs in the order of the runs
+    EXPECT_EQ(order, "abcdfegh");
+}
+
+TEST(LoggerTest, TestCustomBuffer)
+{
+    static_assert(!jaut::isMultiProducerBuffer_v<DequeBuffer<4, jaut::LogMessage>>);
+    static_assert(!jaut::isMultiProducerBuffer_v<jaut::SimpleRingBuffer<4, jaut::LogMessage>>);
+    static_assert( jaut::isMultiProducerBuffer_v<jaut::MpscRingBuffer<4, jaut::LogMessage>>);
+    
+    std::stringstream stream;
+    
+    {
+        jaut::BasicLogger<jaut::LogWorkerSimple<4, juce::CriticalSection, DequeBuffer>>::Options options;
+        options.onUnexpectedThrow = ::onThrow;
+        
+        jaut::BasicLogger<jaut::LogWorkerSimple<4, juce::CriticalSection, DequeBuffer>> logger(
+            "CUSTOM_BUFFER", std::move(options), std::make_unique<jaut::LogSinkOstream<>>(
+                stream,
+                std::make_unique<jaut::LogFormatCallback>([](const jaut::LogMessage &msg)
+                {
+                    return msg.message + '\n';
+                })));
+        
+        logger.info("First");
+        logger.info("Second");
+    }
+    
+    // Without the trait, the worker has to assume one producer and guard the buffer with its lock
+    EXPECT_EQ(prepString(stream.str()), "First\nSecond\n");
+}
+
 //======================================================================================================================
 // endregion Unit Tests
 //**********************************************************************************************************************
@@ -33,7 +33,11 @@
  */
 
 #include <jaut_logger/jaut_AbstractLogger.cpp>
+#include <jaut_logger/jaut_LogClock.cpp>
+#include <jaut_logger/jaut_LogRecord.cpp>
+#include <jaut_logger/jaut_LogSymbol.cpp>
 #include <jaut_logger/jaut_BasicLogger.h>
+#include <jaut_logger/format/jaut_LogFormatBinary.cpp>
 #include <jaut_logger/format/jaut_LogFormatJson.cpp>
 #include <jaut_logger/format/jaut_LogFormatPattern.cpp>
 #include <jaut_logger/format/jaut_LogFormatXml.cpp>
@@ -88,6 +92,147 @@ namespace
 //**********************************************************************************************************************
 // region Unit Tests
 //======================================================================================================================
+TEST(LoggerFormatTest, TestPatternFormatter)
+{
+    jaut::LogMessage message;
+    message.name       = "pattern-logger";
+    message.message    = "Test message";
+    message.threadName = "worker";
+    message.threadId   = std::this_thread::get_id();
+    message.timestamp  = juce::Time(86400000);
+    message.level      = jaut::LogLevel::Info;
+    message.fields.push_back(jaut::mfield("answer", 42));
+    
+    {
+        const jaut::LogFormatPattern formatter("{{{name}}} [{level:>5}][{t_ref}]: {msg} ({fd_answer})");
+        EXPECT_EQ(prepString(formatter.format(message)), "{pattern-logger} [ Info][worker]: Test message (42)\n");
+    }
+    
+    {
+        const jaut::LogFormatPattern formatter("{time_g:%F %T} {ex_id}/{ex_msg}");
+        EXPECT_EQ(prepString(formatter.format(message)), "1970-01-02 00:00:00 n/a/n/a\n");
+        
+        // the cached time must be replaced once the second changes
+        message.timestamp = juce::Time(86401500);
+        EXPECT_EQ(prepString(formatter.format(message)), "1970-01-02 00:00:01 n/a/n/a\n");
+        
+        message.timestamp = juce::Time(86400000);
+    }
+    
+    // positional arguments can't be compiled, so this goes through the runtime path
+    {
+        const jaut::LogFormatPattern formatter("{1} ({fd_answer}) [{level}]");
+        EXPECT_EQ(prepString(formatter.format(message)), "Test message (42) [Info]\n");
+    }
+    
+    // exception pattern
+    {
+        message.exception = jaut::LogMessage::ExceptionSpec{ "std::runtime_error", "oh no" };
+        
+        const jaut::LogFormatPattern formatter("{msg}", "{msg}: {ex_id}: {ex_msg}");
+        EXPECT_EQ(prepString(formatter.format(message)), "Test message: std::runtime_error: oh no\n");
+    }
+    
+    // formatting into a buffer should append
+    {
+        const jaut::LogFormatPattern formatter("{msg}");
+        
+        fmt::memory_buffer buffer;
+        formatter.formatTo(buffer, message);
+        formatter.formatTo(buffer, message);
+        
+        EXPECT_EQ(prepString(juce::String::fromUTF8(buffer.data(), static_cast<int>(buffer.size()))),
+                  "Test message\nTest message\n");
+    }
+}
+
+TEST(LoggerFormatTest, TestTimestampCache)
+{
+    jaut::LogTimestampCache cache;
+    
+    EXPECT_EQ(cache.format(0, 86400, jaut::LogTimestampCache::Zone::Utc, "{:%F %T}"), "1970-01-02 00:00:00");
+    EXPECT_EQ(cache.format(1, 86400, jaut::LogTimestampCache::Zone::Utc, "{:%T}"),    "00:00:00");
+    EXPECT_EQ(cache.format(0, 86461, jaut::LogTimestampCache::Zone::Utc, "{:%F %T}"), "1970-01-02 00:01:01");
+    EXPECT_EQ(cache.toCalendarTime(86461, jaut::LogTimestampCache::Zone::Utc).tm_min, 1);
+    
+    for (const juce::int64 millis : { 0ll, 999ll, 1000ll, 1001ll, 86400005ll, 86400999ll, 86401000ll, 1700000000123ll })
+    {
+        EXPECT_EQ(cache.toISO8601(millis), juce::Time(millis).toISO8601(true));
+    }
+}
+
+TEST(LoggerFormatTest, TestBinaryFormatter)
+{
+    jaut::LogMessage message;
+    message.name       = "binary-logger";
+    message.message    = "Test message";
+    message.threadName = "worker";
+    message.threadId   = std::this_thread::get_id();
+    message.timestamp  = juce::Time(1700000000123);
+    message.level      = jaut::LogLevel::Warn;
+    message.exception  = jaut::LogMessage::ExceptionSpec{ "std::runtime_error", "oh no" };
+    message.fields.push_back(jaut::mfield("int",    -42));
+    message.fields.push_back(jaut::mfield("big",    static_cast<juce::int64>(1) << 40));
+    message.fields.push_back(jaut::mfield("double", 0.5));
+    message.fields.push_back(jaut::mfield("bool",   true));
+    message.fields.push_back(jaut::mfield("string", "text"));
+    
+    const jaut::LogFormatBinary formatter;
+    fmt::memory_buffer          buffer;
+    
+    const juce::String header = formatter.getHeader();
+    buffer.append(header.toRawUTF8(), header.toRawUTF8() + header.getNumBytesAsUTF8());
+    buffer.push_back('\n');
+    
+    for (int i = 0; i < 3; ++i)
+    {
+        formatter.formatTo(buffer, message);
+        message.timestamp = juce::Time(message.timestamp.toMilliseconds() + 1500);
+    }
+    
+    jaut::LogFormatBinary::Decoder         decoder(buffer.data(), buffer.size());
+    jaut::LogFormatBinary::Decoder::Record record;
+    
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_TRUE(decoder.next(record));
+        
+        const jaut::LogMessage &decoded = record.message;
+        EXPECT_EQ(decoded.name,       message.name);
+        EXPECT_EQ(decoded.threadName, message.threadName);
+        EXPECT_EQ(decoded.message,    message.message);
+        EXPECT_EQ(decoded.level,      message.level);
+        EXPECT_EQ(decoded.timestamp.toMilliseconds(), 1700000000123 + i * 1500);
+        EXPECT_EQ(record.threadId,    jaut::toString(message.threadId));
+        
+        ASSERT_TRUE(decoded.exception.has_value());
+        EXPECT_EQ(decoded.exception->name,    "std::runtime_error");
+        EXPECT_EQ(decoded.exception->message, "oh no");
+        
+        ASSERT_EQ(decoded.fields.size(), message.fields.size());
+        
+        for (std::size_t j = 0; j < decoded.fields.size(); ++j)
+        {
+            EXPECT_EQ(decoded.fields[j].name, message.fields[j].name);
+            EXPECT_EQ(decoded.fields[j].value, message.fields[j].value);
+        }
+    }
+    
+    EXPECT_FALSE(decoder.next(record));
+    EXPECT_FALSE(decoder.hasFailed());
+    
+    // A truncated log must not be read past its end
+    jaut::LogFormatBinary::Decoder truncated(buffer.data(), buffer.size() - 1);
+    
+    for (int i = 0; i < 2; ++i)
+    {
+        EXPECT_TRUE(truncated.next(record));
+    }
+    
+    EXPECT_FALSE(truncated.next(record));
+    EXPECT_TRUE(truncated.hasFailed());
+}
+
 TEST(LoggerFormatTest, TestJsonAppendingFormatter)
 {
     jaut::LoggerSimple::Options options;
@@ -138,6 +283,54 @@ TEST(LoggerFormatTest, TestJsonAppendingFormatter)
     }
 }
 
+TEST(LoggerFormatTest, TestJsonLinesFormatter)
+{
+    jaut::LoggerSimple::Options options;
+    options.onUnexpectedThrow = ::onThrow;
+    
+    jaut::LogFormatJson::Options fj_options;
+    fj_options.jsonLines = true;
+    fj_options.omitEmpty = true;
+    
+    std::stringstream stream;
+    
+    jaut::LoggerSimple logger("json-logger", std::move(options),
+        std::make_unique<jaut::LogSinkOstream<>>(
+            stream,
+            std::make_unique<jaut::LogFormatJson>(fj_options)
+        )
+    );
+    
+    logger << jaut::LogLevel::Info << "Test \"quoted\" message";
+    logger << jaut::LogLevel::Warn << "Multi\nline" << jaut::mfield("answer", 42);
+    
+    const juce::StringArray lines = juce::StringArray::fromLines(juce::String(stream.str()).trimEnd());
+    ASSERT_EQ(lines.size(), 2) << "Content: " << stream.str();
+    
+    {
+        const juce::var                  json = juce::JSON::parse(lines[0]);
+        const juce::DynamicObject *const root = json.getDynamicObject();
+        ASSERT_TRUE(root != nullptr) << "Content: " << lines[0];
+        
+        EXPECT_EQ(root->getProperty("message").toString(), "Test \"quoted\" message");
+        EXPECT_FALSE(root->hasProperty("exception"));
+        EXPECT_FALSE(root->hasProperty("fields"));
+    }
+    
+    {
+        const juce::var                  json = juce::JSON::parse(lines[1]);
+        const juce::DynamicObject *const root = json.getDynamicObject();
+        ASSERT_TRUE(root != nullptr) << "Content: " << lines[1];
+        
+        EXPECT_EQ(root->getProperty("message").toString(), "Multi\nline");
+        EXPECT_FALSE(root->hasProperty("exception"));
+        
+        const juce::Array<juce::var> *const fields = root->getProperty("fields").getArray();
+        ASSERT_TRUE(fields != nullptr && fields->size() == 1);
+        EXPECT_EQ(static_cast<int>(fields->getReference(0).getProperty("value", {})), 42);
+    }
+}
+
 TEST(LoggerFormatTest, TestJsonReplacingFormatter)
 {
     jaut::LoggerSimple::Options options;
@@ -247,6 +440,94 @@ TEST(LoggerFormatTest, TestJsonReplacingFormatterWithInvalidJson)
     }
 }
 
+TEST(LoggerFormatTest, TestJsonInPlaceFormatter)
+{
+    jaut::LoggerSimple::Options options;
+    options.onUnexpectedThrow = ::onThrow;
+    
+    const juce::File file = juce::File::getSpecialLocation(juce::File::SpecialLocationType::currentExecutableFile)
+                                       .getParentDirectory().getChildFile("in-place.json");
+    (void) file.deleteFile();
+    
+    for (const bool pretty_print : { true, false })
+    {
+        jaut::LogFormatJson::Options fj_options;
+        fj_options.prettyPrint = pretty_print;
+        
+        // the second session should carry over the events of the first one
+        for (int session = 0; session < 2; ++session)
+        {
+            jaut::LoggerSimple logger("json-logger", options,
+                std::make_unique<jaut::LogSinkFile>(
+                    file,
+                    jaut::LogSinkFile::Options{ std::make_unique<jaut::LogFormatJson>(fj_options), 4096, true, false,
+                                                true }
+                )
+            );
+            
+            for (int i = 0; i < 4; ++i)
+            {
+                logger << jaut::LogLevel::Info << juce::String((session * 4) + i);
+                
+                const juce::var                     json = juce::JSON::parse(file.loadFileAsString());
+                const juce::Array<juce::var> *const root = json.getArray();
+                ASSERT_TRUE(root != nullptr) << "Content: " << file.loadFileAsString();
+                ASSERT_EQ(root->size(), (session * 4) + i + 1);
+                
+                for (int j = 0; j < root->size(); ++j)
+                {
+                    const juce::DynamicObject *const obj = root->getReference(j).getDynamicObject();
+                    ASSERT_TRUE(obj != nullptr);
+                    EXPECT_EQ(static_cast<int>(obj->getProperty("message")), j);
+                }
+            }
+        }
+        
+        (void) file.deleteFile();
+    }
+}
+
+TEST(LoggerFormatTest, TestJsonInPlaceFormatterWithInvalidJson)
+{
+    jaut::LoggerSimple::Options options;
+    options.onUnexpectedThrow = ::onThrow;
+    
+    jaut::LogFormatJson::Options fj_options;
+    fj_options.prettyPrint           = false;
+    fj_options.tryPreserveInvalidLog = true;
+    
+    const juce::File file = juce::File::getSpecialLocation(juce::File::SpecialLocationType::currentExecutableFile)
+                                       .getParentDirectory().getChildFile("in-place-invalid-test.json");
+    (void) file.replaceWithText("[{\"name\": \"broken\"");
+    
+    {
+        jaut::LoggerSimple logger("json-logger", options,
+            std::make_unique<jaut::LogSinkFile>(
+                file,
+                jaut::LogSinkFile::Options{ std::make_unique<jaut::LogFormatJson>(fj_options), 4096, true, false, true }
+            )
+        );
+        
+        logger << jaut::LogLevel::Info << "0";
+        logger << jaut::LogLevel::Info << "1";
+    }
+    
+    const juce::String content = file.loadFileAsString();
+    EXPECT_TRUE(content.startsWith("[{\"name\": \"broken\""));
+    
+    const juce::var json = juce::JSON::parse(content.fromLastOccurrenceOf("---BEGIN VALID---", false, false));
+    
+    const juce::Array<juce::var> *const root = json.getArray();
+    ASSERT_TRUE(root != nullptr && root->size() == 2) << "Content: " << content;
+    
+    for (int j = 0; j < 2; ++j)
+    {
+        const juce::DynamicObject *const obj = root->getReference(j).getDynamicObject();
+        ASSERT_TRUE(obj != nullptr);
+        EXPECT_EQ(static_cast<int>(obj->getProperty("message")), j);
+    }
+}
+
 TEST(LoggerFormatTest, TestXmlAppendingFormatter)
 {
     jaut::LoggerSimple::Options options;
@@ -420,6 +701,44 @@ TEST(LoggerFormatTest, TestXmlReplacingFormatterWithInvalidXml)
     EXPECT_TRUE(ints.empty());
 }
 
+TEST(LoggerFormatTest, TestXmlInPlaceFormatter)
+{
+    jaut::LoggerSimple::Options options;
+    options.onUnexpectedThrow = ::onThrow;
+    
+    const juce::File file = juce::File::getSpecialLocation(juce::File::SpecialLocationType::currentExecutableFile)
+                                       .getParentDirectory().getChildFile("in-place.xml");
+    (void) file.deleteFile();
+    
+    // the second session should carry over the events of the first one
+    for (int session = 0; session < 2; ++session)
+    {
+        jaut::LoggerSimple logger("xml-logger", options,
+            std::make_unique<jaut::LogSinkFile>(
+                file,
+                jaut::LogSinkFile::Options{ std::make_unique<jaut::LogFormatXml>(), 4096, true, false, true }
+            )
+        );
+        
+        for (int i = 0; i < 4; ++i)
+        {
+            logger << jaut::LogLevel::Info << juce::String((session * 4) + i);
+            
+            const std::unique_ptr<juce::XmlElement> xml = juce::XmlDocument::parse(file.loadFileAsString());
+            ASSERT_TRUE(xml != nullptr && xml->hasTagName("Log")) << "Content: " << file.loadFileAsString();
+            ASSERT_EQ(xml->getNumChildElements(), (session * 4) + i + 1);
+            
+            int j = 0;
+            
+            for (const juce::XmlElement *const element : xml->getChildIterator())
+            {
+                ASSERT_TRUE(element->hasTagName("Event"));
+                EXPECT_EQ(element->getChildByName("Message")->getAllSubText().getIntValue(), j++);
+            }
+        }
+    }
+}
+
 //======================================================================================================================
 // endregion Unit Tests
 //**********************************************************************************************************************
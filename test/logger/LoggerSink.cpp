@@ -33,7 +33,11 @@
  */
  
 #include <jaut_logger/jaut_AbstractLogger.cpp>
+#include <jaut_logger/jaut_LogClock.cpp>
+#include <jaut_logger/jaut_LogRecord.cpp>
+#include <jaut_logger/jaut_LogSymbol.cpp>
 #include <jaut_logger/jaut_BasicLogger.h>
+#include <jaut_logger/format/jaut_LogFormatBinary.cpp>
 #include <jaut_logger/format/jaut_LogFormatCallback.cpp>
 #include <jaut_logger/format/jaut_LogFormatPattern.cpp>
 #include <jaut_logger/rotation/jaut_LogRotationManager.cpp>
@@ -42,12 +46,17 @@
 #include <jaut_logger/rotation/strategies/jaut_StrategyPattern.cpp>
 #include <jaut_logger/sink/jaut_LogSinkRotatingFile.cpp>
 #include <jaut_logger/sink/jaut_LogSinkFile.cpp>
+#include <jaut_logger/sink/jaut_LogSinkMapped.cpp>
+#include <jaut_logger/sink/jaut_LogSinkPosixFile.cpp>
 #include <jaut_logger/sink/jaut_LogSinkOstream.h>
+#include <jaut_logger/worker/jaut_LogWorkerThreaded.cpp>
 
 #include <jaut_core/util/jaut_CommonUtils.h>
 
 #include <gtest/gtest.h>
 
+#include <functional>
+
 
 
 //**********************************************************************************************************************
@@ -111,16 +120,14 @@ namespace
         {
             const std::thread::id tid = std::this_thread::get_id();
             
-            // test if sorting by time
-            logger->log({ {}, std::nullopt, "VERBOSE TEST", name, "", tid, juce::Time(2), jaut::LogLevel::Verbose });
-            logger->log({ {}, std::nullopt, "FATAL TEST",   name, "", tid, juce::Time(6), jaut::LogLevel::Fatal   });
-            logger->log({ {}, std::nullopt, "DEBUG TEST",   name, "", tid, juce::Time(1), jaut::LogLevel::Debug   });
-            logger->log({ {}, std::nullopt, "ERROR TEST",   name, "", tid, juce::Time(5), jaut::LogLevel::Error   });
-            logger->log({ {}, std::nullopt, "TRACE TEST",   name, "", tid, juce::Time(0), jaut::LogLevel::Trace   });
-            
-            // test if insertion order by same timestamp
-            logger->log({ {}, std::nullopt, "INFO TEST", name, "", tid, juce::Time(4), jaut::LogLevel::Info });
-            logger->log({ {}, std::nullopt, "WARN TEST", name, "", tid, juce::Time(4), jaut::LogLevel::Warn });
+            // test if insertion order is kept, regardless of the timestamps
+            logger->log({ {}, std::nullopt, "TRACE TEST",   name, "", tid, juce::Time(6), jaut::LogLevel::Trace   });
+            logger->log({ {}, std::nullopt, "DEBUG TEST",   name, "", tid, juce::Time(2), jaut::LogLevel::Debug   });
+            logger->log({ {}, std::nullopt, "VERBOSE TEST", name, "", tid, juce::Time(5), jaut::LogLevel::Verbose });
+            logger->log({ {}, std::nullopt, "INFO TEST",    name, "", tid, juce::Time(0), jaut::LogLevel::Info    });
+            logger->log({ {}, std::nullopt, "WARN TEST",    name, "", tid, juce::Time(4), jaut::LogLevel::Warn    });
+            logger->log({ {}, std::nullopt, "ERROR TEST",   name, "", tid, juce::Time(4), jaut::LogLevel::Error   });
+            logger->log({ {}, std::nullopt, "FATAL TEST",   name, "", tid, juce::Time(1), jaut::LogLevel::Fatal   });
         }
         else
         {
@@ -187,6 +194,33 @@ namespace
         return file.loadFileAsString();
     }
     
+    #if JUCE_LINUX || JUCE_BSD || JUCE_MAC || JUCE_IOS || JUCE_ANDROID
+    juce::String makePosixFileLevelTest(jaut::LogLevel::Value level, const juce::String &name, bool async)
+    {
+        using Sink = jaut::LogSinkPosixFile;
+        
+        const juce::File file = juce::File::getSpecialLocation(juce::File::SpecialLocationType::currentExecutableFile)
+                                           .getParentDirectory()
+                                           .getChildFile(name + ".posix.log");
+        (void) file.deleteFile();
+        
+        jaut::LogSinkPosixFile::Options options;
+        options.formatter = std::make_unique<jaut::LogFormatPattern>("{msg}");
+        
+        if (async)
+        {
+            (void) prepareLogger<jaut::LoggerAsync>(level, name, std::make_unique<Sink>(file, std::move(options)));
+            juce::Thread::sleep(3000);
+        }
+        else
+        {
+            (void) prepareLogger<jaut::LoggerSimple>(level, name, std::make_unique<Sink>(file, std::move(options)));
+        }
+        
+        return file.loadFileAsString();
+    }
+    #endif
+    
     void basicLevelTest(juce::String(*func)(jaut::LogLevel::Value, const juce::String&, bool), bool async)
     {
         juce::String test_string;
@@ -285,6 +319,170 @@ TEST(LoggerSinkTest, TestFileSink)
     }
 }
 
+#if JUCE_LINUX || JUCE_BSD || JUCE_MAC || JUCE_IOS || JUCE_ANDROID
+TEST(LoggerSinkTest, TestPosixFileSink)
+{
+    // Sync test
+    basicLevelTest(&::makePosixFileLevelTest, false);
+    
+    // Async test
+    basicLevelTest(&::makePosixFileLevelTest, true);
+    
+    // Direct I/O test, every session should keep what the previous one wrote
+    {
+        const juce::File file = juce::File::getSpecialLocation(juce::File::SpecialLocationType::currentExecutableFile)
+                                           .getParentDirectory().getChildFile("direct-file.posix.log");
+        (void) file.deleteFile();
+        
+        juce::String expected;
+        
+        for (int session = 0; session < 3; ++session)
+        {
+            jaut::LoggerSimple::Options options;
+            options.onUnexpectedThrow = ::onThrow;
+            
+            jaut::LogSinkPosixFile::Options sf_options;
+            sf_options.directIo     = true;
+            sf_options.syncInterval = 1;
+            sf_options.formatter    = std::make_unique<jaut::LogFormatCallback>([](const jaut::LogMessage &msg)
+                                                                                {
+                                                                                    return msg.message + '\n';
+                                                                                });
+            
+            jaut::LoggerSimple logger("DIRECT", std::move(options),
+                                      std::make_unique<jaut::LogSinkPosixFile>(file, std::move(sf_options)));
+            
+            for (int i = 0; i < 500; ++i)
+            {
+                const juce::String message = "Session " + juce::String(session) + " message " + juce::String(i);
+                logger << jaut::LogLevel::Info << message;
+                expected << message << '\n';
+            }
+            
+            EXPECT_EQ(file.loadFileAsString(), expected);
+        }
+    }
+}
+
+TEST(LoggerSinkTest, TestMappedFileSink)
+{
+    const juce::File file = juce::File::getSpecialLocation(juce::File::SpecialLocationType::currentExecutableFile)
+                                       .getParentDirectory().getChildFile("mapped.log");
+    (void) file.deleteFile();
+    
+    juce::String expected;
+    juce::String rotated;
+    int          num_rotations = 0;
+    
+    {
+        jaut::LoggerSimple::Options options;
+        options.onUnexpectedThrow = ::onThrow;
+        
+        jaut::LogSinkMapped::Options sf_options;
+        sf_options.segmentSize      = 1024;
+        sf_options.syncOnFlush      = true;
+        sf_options.rotationStrategy = [&rotated, &num_rotations](const jaut::LogRotationManager &manager)
+                                      {
+                                          rotated << manager.getLogFile().loadFileAsString();
+                                          ++num_rotations;
+                                          
+                                          return juce::File();
+                                      };
+        sf_options.formatter        = std::make_unique<jaut::LogFormatCallback>([](const jaut::LogMessage &msg)
+                                                                                {
+                                                                                    return msg.message + '\n';
+                                                                                });
+        
+        jaut::LoggerSimple logger("MAPPED", std::move(options),
+                                  std::make_unique<jaut::LogSinkMapped>(file, std::move(sf_options)));
+        
+        for (int i = 0; i < 300; ++i)
+        {
+            const juce::String message = "Mapped message " + juce::String(i);
+            logger << jaut::LogLevel::Info << message;
+            expected << message << '\n';
+        }
+        
+        // an event bigger than a segment should still make it in one piece
+        const juce::String big_message = juce::String::repeatedString("B", 3000);
+        logger << jaut::LogLevel::Info << big_message;
+        expected << big_message << '\n';
+    }
+    
+    const juce::String content = file.loadFileAsString();
+    
+    EXPECT_GT(num_rotations, 1);
+    EXPECT_EQ(file.getSize(), static_cast<juce::int64>(content.getNumBytesAsUTF8()));
+    EXPECT_EQ(rotated + content, expected);
+}
+
+TEST(LoggerSinkTest, TestMappedFileSinkBinaryReopen)
+{
+    const juce::File dir     = juce::File::getSpecialLocation(juce::File::SpecialLocationType::currentExecutableFile)
+                                          .getParentDirectory();
+    const juce::File file    = dir.getChildFile("binary.mapped.log");
+    const juce::File crashed = dir.getChildFile("binary.mapped.crashed.log");
+    (void) file   .deleteFile();
+    (void) crashed.deleteFile();
+    
+    constexpr int num_messages = 5;
+    
+    // Events without fields end in a zero byte, which must not be mistaken for the unused rest of the segment
+    const auto log_session = [](const juce::File &logFile, int first, const std::function<void()> &beforeClose)
+    {
+        jaut::LoggerSimple::Options options;
+        options.onUnexpectedThrow = ::onThrow;
+        
+        jaut::LogSinkMapped::Options sf_options;
+        sf_options.segmentSize = 4096;
+        sf_options.formatter   = std::make_unique<jaut::LogFormatBinary>();
+        
+        jaut::LoggerSimple logger("binary", std::move(options),
+                                  std::make_unique<jaut::LogSinkMapped>(logFile, std::move(sf_options)));
+        
+        for (int i = first; i < (first + num_messages); ++i)
+        {
+            logger << jaut::LogLevel::Info << ("Binary mapped message " + juce::String(i));
+        }
+        
+        logger.flush();
+        beforeClose();
+    };
+    
+    const auto expect_messages = [](const juce::File &logFile, int count)
+    {
+        juce::MemoryBlock log;
+        ASSERT_TRUE(logFile.loadFileAsData(log));
+        
+        jaut::LogFormatBinary::Decoder         decoder(log.getData(), log.getSize());
+        jaut::LogFormatBinary::Decoder::Record record;
+        
+        int i = 0;
+        
+        while (decoder.next(record))
+        {
+            EXPECT_EQ(record.message.message, "Binary mapped message " + juce::String(i));
+            ++i;
+        }
+        
+        EXPECT_FALSE(decoder.hasFailed());
+        EXPECT_EQ(i, count);
+    };
+    
+    // While the sink is still open, a copy of the file looks just like the log of a process that crashed
+    log_session(file, 0, [&file, &crashed]() { ASSERT_TRUE(file.copyFileTo(crashed)); });
+    expect_messages(file, num_messages);
+    
+    // a log that was closed properly
+    log_session(file, num_messages, []() {});
+    expect_messages(file, num_messages * 2);
+    
+    // a log that was left behind by a crash
+    log_session(crashed, num_messages, []() {});
+    expect_messages(crashed, num_messages * 2);
+}
+#endif
+
 TEST(LoggerSinkTest, TestRotatingFileSink)
 {
     if (juce::Thread *const thread = juce::Thread::getCurrentThread())
@@ -372,6 +570,372 @@ TEST(LoggerSinkTest, TestRotatingFileSink)
         EXPECT_EQ(prepString(file.loadFileAsString()), (juce::String(messages[i].data()) + '\n'));
     }
 }
+
+TEST(LoggerSinkTest, TestRotatingFileSinkRendersOnce)
+{
+    const juce::File file = juce::File::getSpecialLocation(juce::File::SpecialLocationType::currentExecutableFile)
+                                       .getParentDirectory().getChildFile("replacing.rotator.log");
+    
+    ::cleanLogs(file);
+    
+    int num_appended = 0;
+    int num_replaced = 0;
+    
+    jaut::LoggerSimple::Options options;
+    options.onUnexpectedThrow = ::onThrow;
+    
+    jaut::LogSinkRotatingFile::Options sf_options;
+    sf_options.append         = false;
+    sf_options.rotationPolicy = jaut::PolicySizeLimit(1024);
+    sf_options.formatter      = std::make_unique<jaut::LogFormatCallback>(
+        [&num_appended](const jaut::LogMessage &msg)
+        {
+            ++num_appended;
+            return msg.message + '\n';
+        },
+        [&num_replaced](const jaut::LogMessage &msg, const juce::String &content)
+        {
+            ++num_replaced;
+            return content + msg.message + '\n';
+        });
+    
+    jaut::LoggerSimple logger("REPLACER", std::move(options),
+                              std::make_unique<jaut::LogSinkRotatingFile>(file, std::move(sf_options)));
+    
+    logger << jaut::LogLevel::Info << "Test 1";
+    logger << jaut::LogLevel::Info << "Test 2";
+    logger << jaut::LogLevel::Info << "Test 3";
+    
+    // The replacing output is all the rotation policy needs, so the message must not be formatted twice
+    EXPECT_EQ(num_appended, 0);
+    EXPECT_EQ(num_replaced, 3);
+    EXPECT_EQ(prepString(file.loadFileAsString()), "Test 1\nTest 2\nTest 3\n");
+}
+
+TEST(LoggerSinkTest, TestRotatingFileSinkAsyncRotation)
+{
+    const juce::File file = juce::File::getSpecialLocation(juce::File::SpecialLocationType::currentExecutableFile)
+                                       .getParentDirectory().getChildFile("async.rotator.log");
+    (void) file.deleteFile();
+    
+    const std::thread::id main_thread = std::this_thread::get_id();
+    
+    juce::String     expected;
+    juce::String     rotated;
+    bool             on_logging_thread = false;
+    std::atomic<int> num_rotated { 0 };
+    
+    {
+        jaut::LoggerSimple::Options options;
+        options.onUnexpectedThrow = ::onThrow;
+        
+        jaut::LogSinkRotatingFile::Options sf_options;
+        sf_options.asyncRotation    = true;
+        sf_options.rotationPolicy   = jaut::PolicySizeLimit(45);
+        sf_options.rotationStrategy = [&](const jaut::LogRotationManager &manager)
+                                      {
+                                          // Only ever touched by the rotation thread until the logger is gone
+                                          rotated << manager.getRotationSource().loadFileAsString();
+                                          on_logging_thread |= (std::this_thread::get_id() == main_thread);
+                                          
+                                          return juce::File();
+                                      };
+        sf_options.formatter        = std::make_unique<jaut::LogFormatCallback>([](const jaut::LogMessage &msg)
+                                                                                {
+                                                                                    return msg.message + '\n';
+                                                                                });
+        
+        auto log_sink_file = std::make_unique<jaut::LogSinkRotatingFile>(file, std::move(sf_options));
+        log_sink_file->eventLogRotated += jaut::makeHandler([&num_rotated](const juce::File&)
+                                                            {
+                                                                ++num_rotated;
+                                                            });
+        
+        jaut::LoggerSimple logger("async", std::move(options), std::move(log_sink_file));
+        
+        for (int i = 0; i < 20; ++i)
+        {
+            const juce::String message = "Async rotated message " + juce::String(i);
+            logger << jaut::LogLevel::Info << message;
+            expected << message << '\n';
+        }
+    }
+    
+    // The logger is gone, so all pending rotations must have been archived by now
+    EXPECT_GT(num_rotated.load(), 0);
+    EXPECT_FALSE(on_logging_thread);
+    EXPECT_EQ(prepString(rotated + file.loadFileAsString()), expected);
+    EXPECT_EQ(file.getParentDirectory().findChildFiles(juce::File::findFiles, false, "*.rotating").size(), 0);
+}
+
+TEST(LoggerSinkTest, TestRotatingFileSinkBinary)
+{
+    const juce::File file = juce::File::getSpecialLocation(juce::File::SpecialLocationType::currentExecutableFile)
+                                       .getParentDirectory().getChildFile("binary.rotator.log");
+    (void) file.deleteFile();
+    
+    constexpr int num_messages = 20;
+    
+    std::vector<juce::MemoryBlock> logs;
+    const juce::int64              start = juce::Time::currentTimeMillis();
+    
+    {
+        jaut::LoggerSimple::Options options;
+        options.onUnexpectedThrow = ::onThrow;
+        
+        jaut::LogSinkRotatingFile::Options sf_options;
+        sf_options.rotationPolicy   = jaut::PolicySizeLimit(200);
+        sf_options.rotationStrategy = [&logs](const jaut::LogRotationManager &manager)
+                                      {
+                                          logs.emplace_back();
+                                          (void) manager.getRotationSource().loadFileAsData(logs.back());
+                                          
+                                          return juce::File();
+                                      };
+        sf_options.formatter        = std::make_unique<jaut::LogFormatBinary>();
+        
+        jaut::LoggerSimple logger("binary", std::move(options),
+                                  std::make_unique<jaut::LogSinkRotatingFile>(file, std::move(sf_options)));
+        
+        for (int i = 0; i < num_messages; ++i)
+        {
+            logger << jaut::LogLevel::Info << ("Binary rotated message " + juce::String(i));
+        }
+    }
+    
+    const juce::int64 end = juce::Time::currentTimeMillis();
+    
+    ASSERT_FALSE(logs.empty());
+    logs.emplace_back();
+    ASSERT_TRUE(file.loadFileAsData(logs.back()));
+    
+    // Every log has to be readable on its own, so the first event after a rotation must not rely on
+    // symbols or a timestamp that were only written to the previous log
+    int i = 0;
+    
+    for (const juce::MemoryBlock &log : logs)
+    {
+        jaut::LogFormatBinary::Decoder         decoder(log.getData(), log.getSize());
+        jaut::LogFormatBinary::Decoder::Record record;
+        
+        while (decoder.next(record))
+        {
+            const jaut::LogMessage &decoded = record.message;
+            EXPECT_EQ(decoded.name.toString(), "binary");
+            EXPECT_EQ(decoded.message, "Binary rotated message " + juce::String(i));
+            EXPECT_GE(decoded.timestamp.toMilliseconds(), start - 1000);
+            EXPECT_LE(decoded.timestamp.toMilliseconds(), end   + 1000);
+            ++i;
+        }
+        
+        EXPECT_FALSE(decoder.hasFailed());
+    }
+    
+    EXPECT_EQ(i, num_messages);
+}
+
+TEST(LoggerSinkTest, TestStrategyPatternGzip)
+{
+    const juce::File file = juce::File::getSpecialLocation(juce::File::SpecialLocationType::currentExecutableFile)
+                                       .getParentDirectory().getChildFile("gzip.rotator.log");
+    
+    // Several chunks worth of log, so that the archive is written in more than one go
+    juce::String content;
+    
+    for (int i = 0; i < 2000; ++i)
+    {
+        content << "Compressed line nr " << i << '\n';
+    }
+    
+    ASSERT_TRUE(file.replaceWithText(content, false, false, nullptr));
+    
+    jaut::StrategyPattern::Options sp_options;
+    sp_options.chunkSize = 1024;
+    
+    jaut::LogRotationManager manager(file, [](const jaut::RotationPolicyArgs&) { return false; },
+                                     jaut::StrategyPattern("rotated/gzip.rotator.log.gz", sp_options));
+    
+    juce::File archive;
+    manager.eventAfterRotation += jaut::makeHandler([&archive](const juce::File &rotated)
+                                                    {
+                                                        archive = rotated;
+                                                    });
+    manager.forceRotateLogs();
+    
+    ASSERT_TRUE(archive.existsAsFile());
+    EXPECT_EQ(file.getSize(), 0);
+    
+    juce::GZIPDecompressorInputStream gzis(archive.createInputStream().release(), true,
+                                           juce::GZIPDecompressorInputStream::gzipFormat);
+    EXPECT_EQ(gzis.readEntireStreamAsString(), content);
+}
+
+TEST(LoggerSinkTest, TestStrategyPatternZip)
+{
+    const juce::File file = juce::File::getSpecialLocation(juce::File::SpecialLocationType::currentExecutableFile)
+                                       .getParentDirectory().getChildFile("zip.rotator.log");
+    
+    // Several chunks worth of log, so that the archive is written in more than one go
+    juce::String content;
+    
+    for (int i = 0; i < 2000; ++i)
+    {
+        content << "Zipped line nr " << i << '\n';
+    }
+    
+    ASSERT_TRUE(file.replaceWithText(content, false, false, nullptr));
+    
+    jaut::StrategyPattern::Options sp_options;
+    sp_options.chunkSize = 1024;
+    sp_options.overwrite = true;
+    
+    jaut::LogRotationManager manager(file, [](const jaut::RotationPolicyArgs&) { return false; },
+                                     jaut::StrategyPattern("rotated/zip.rotator.log.zip", sp_options));
+    
+    juce::File archive;
+    manager.eventAfterRotation += jaut::makeHandler([&archive](const juce::File &rotated)
+                                                    {
+                                                        archive = rotated;
+                                                    });
+    manager.forceRotateLogs();
+    
+    ASSERT_TRUE(archive.existsAsFile());
+    EXPECT_EQ(file.getSize(), 0);
+    
+    juce::ZipFile zip(archive);
+    ASSERT_EQ(zip.getNumEntries(), 1);
+    
+    const juce::ZipFile::ZipEntry *entry = zip.getEntry(0);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->filename,         "zip.rotator.log");
+    EXPECT_EQ(entry->uncompressedSize, static_cast<juce::int64>(content.getNumBytesAsUTF8()));
+    
+    const std::unique_ptr<juce::InputStream> entry_stream(zip.createStreamForEntry(0));
+    ASSERT_NE(entry_stream, nullptr);
+    EXPECT_EQ(entry_stream->readEntireStreamAsString(), content);
+}
+
+TEST(LoggerSinkTest, TestStrategyPatternZip64)
+{
+    const juce::File directory = juce::File::getSpecialLocation(juce::File::SpecialLocationType::currentExecutableFile)
+                                            .getParentDirectory();
+    const juce::File source  = directory.getChildFile("zip64.rotator.log");
+    const juce::File archive = directory.getChildFile("zip64.rotator.log.zip");
+    
+    juce::String content;
+    
+    for (int i = 0; i < 500; ++i)
+    {
+        content << "Zip64 line nr " << i << '\n';
+    }
+    
+    ASSERT_TRUE(source.replaceWithText(content, false, false, nullptr));
+    ASSERT_TRUE(archive.deleteFile());
+    
+    // Logs of 4 GB are not an option for a unit test, so we lower the threshold to force the zip64 layout
+    {
+        juce::FileInputStream  fis(source);
+        juce::FileOutputStream fos(archive);
+        ASSERT_TRUE(::writeZip(fis, fos, "zip64.rotator.log", juce::Time::getCurrentTime(),
+                               jaut::StrategyPattern::Options{}, 0));
+    }
+    
+    juce::MemoryBlock data;
+    ASSERT_TRUE(archive.loadFileAsData(data));
+    
+    const auto *bytes = static_cast<const char*>(data.getData());
+    const auto  size  = static_cast<juce::int64>(data.getSize());
+    
+    const auto read_16 = [bytes](juce::int64 at) { return juce::ByteOrder::littleEndianShort(bytes + at); };
+    const auto read_32 = [bytes](juce::int64 at) { return juce::ByteOrder::littleEndianInt  (bytes + at); };
+    const auto read_64 = [bytes](juce::int64 at) { return juce::ByteOrder::littleEndianInt64(bytes + at); };
+    
+    const auto content_size = static_cast<juce::int64>(content.getNumBytesAsUTF8());
+    
+    // The end of central directory defers its offset to the zip64 records in front of it
+    const juce::int64 eocd = (size - 22);
+    ASSERT_GT(eocd, 20);
+    ASSERT_EQ(read_32(eocd),      0x06054b50u);
+    EXPECT_EQ(read_32(eocd + 16), 0xffffffffu);
+    
+    const juce::int64 locator = (eocd - 20);
+    ASSERT_EQ(read_32(locator), 0x07064b50u);
+    
+    const auto zip64_eocd = static_cast<juce::int64>(read_64(locator + 8));
+    ASSERT_EQ(read_32(zip64_eocd),      0x06064b50u);
+    EXPECT_EQ(read_64(zip64_eocd + 32), 1u);
+    
+    // The central directory entry carries the real sizes in its zip64 extra field
+    const auto directory_start = static_cast<juce::int64>(read_64(zip64_eocd + 48));
+    ASSERT_EQ(read_32(directory_start),      0x02014b50u);
+    EXPECT_EQ(read_32(directory_start + 20), 0xffffffffu);
+    EXPECT_EQ(read_32(directory_start + 24), 0xffffffffu);
+    
+    const juce::uint16 name_size = read_16(directory_start + 28);
+    ASSERT_EQ(read_16(directory_start + 30), 20);
+    EXPECT_EQ(juce::String::fromUTF8(bytes + directory_start + 46, name_size), "zip64.rotator.log");
+    
+    const juce::int64 extra = (directory_start + 46 + name_size);
+    ASSERT_EQ(read_16(extra),     0x0001);
+    ASSERT_EQ(read_16(extra + 2), 16);
+    EXPECT_EQ(static_cast<juce::int64>(read_64(extra + 4)), content_size);
+    
+    const auto compressed = static_cast<juce::int64>(read_64(extra + 12));
+    
+    // The entry itself can be inflated from right after its local header
+    ASSERT_EQ(read_32(0), 0x04034b50u);
+    const juce::int64 data_start = (30 + read_16(26) + read_16(28));
+    ASSERT_LE(data_start + compressed, size);
+    
+    juce::GZIPDecompressorInputStream inflater(new juce::MemoryInputStream(bytes + data_start,
+                                                                           static_cast<std::size_t>(compressed),
+                                                                           false),
+                                               true, juce::GZIPDecompressorInputStream::deflateFormat);
+    EXPECT_EQ(inflater.readEntireStreamAsString(), content);
+    
+    // The data descriptor after the entry must agree with the central directory
+    const juce::int64 descriptor = (data_start + compressed);
+    ASSERT_EQ(read_32(descriptor), 0x08074b50u);
+    EXPECT_EQ(read_32(descriptor + 4), read_32(directory_start + 16));
+    EXPECT_EQ(static_cast<juce::int64>(read_64(descriptor + 8)),  compressed);
+    EXPECT_EQ(static_cast<juce::int64>(read_64(descriptor + 16)), content_size);
+}
+
+TEST(LoggerSinkTest, TestRotationSizeTracking)
+{
+    const juce::File file = juce::File::getSpecialLocation(juce::File::SpecialLocationType::currentExecutableFile)
+                                       .getParentDirectory().getChildFile("tracked.rotator.log");
+    
+    ASSERT_TRUE(file.replaceWithText("abc\n", false, false, nullptr));
+    
+    int rotations = 0;
+    
+    jaut::LogRotationManager manager(file, jaut::PolicySizeLimit(10, true),
+                                     [&rotations](const jaut::LogRotationManager&)
+                                     {
+                                         ++rotations;
+                                         return juce::File();
+                                     });
+    
+    // Only opening reads the size from the file system
+    EXPECT_EQ(manager.getLogSize(), 4u);
+    
+    const jaut::LogMessage message;
+    
+    EXPECT_FALSE(manager.tryRotateLogs(message, 5));
+    manager.reportWritten(5);
+    EXPECT_EQ(manager.getLogSize(), 9u);
+    
+    // The policy must only see what was reported, not what is on disk
+    EXPECT_TRUE(manager.tryRotateLogs(message, 2));
+    EXPECT_EQ(rotations, 1);
+    EXPECT_EQ(manager.getLogSize(), 0u);
+    
+    manager.reportLogSize(12);
+    EXPECT_TRUE(manager.tryRotateLogs(message, 0));
+    EXPECT_EQ(rotations, 2);
+}
+
 //======================================================================================================================
 // endregion Unit Tests
 //**********************************************************************************************************************
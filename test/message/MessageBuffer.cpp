@@ -0,0 +1,361 @@
+/**
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+                     ░░░░░██╗░█████╗░██╗░░░██╗████████╗
+                     ░░░░░██║██╔══██╗██║░░░██║╚══██╔══╝
+                     ░░░░░██║███████║██║░░░██║░░░██║░░░
+                     ██╗░░██║██╔══██║██║░░░██║░░░██║░░░
+                     ╚█████╔╝██║░░██║╚██████╔╝░░░██║░░░
+                     ░╚════╝░╚═╝░░╚═╝░╚═════╝░░░░╚═╝░░░
+                       JUCE Augmented Utility  Toolbox
+    ─────────────────────────────── ⋆⋅☆⋅⋆ ───────────────────────────────
+    
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any internal version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    Copyright (c) 2022 ElandaSunshine
+    ===============================================================
+
+    @author Elanda
+    @file   MessageBuffer.cpp
+    @date   16, October 2026
+
+    ===============================================================
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <jaut_message/thread/buffer/jaut_AtomicRingBuffer.h>
+#include <jaut_message/thread/buffer/jaut_FastAtomicRingBuffer.h>
+#include <jaut_message/thread/buffer/jaut_MpscRingBuffer.h>
+#include <jaut_message/thread/buffer/jaut_SimpleRingBuffer.h>
+#include <jaut_message/thread/message/jaut_IMessageBuffer.h>
+
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+
+//**********************************************************************************************************************
+// region Suite Setup
+//======================================================================================================================
+namespace
+{
+    //******************************************************************************************************************
+    // region Testing Facilities
+    //==================================================================================================================
+    /** A user-supplied buffer that only has the generic batch functions of jaut::IMessageBuffer. */
+    template<int BufferSize, class T>
+    class DequeBuffer : public jaut::IMessageBuffer<T>
+    {
+    public:
+        int push(T message) override
+        {
+            if (isFull())
+            {
+                return -1;
+            }
+            
+            queue.push_back(std::move(message));
+            return static_cast<int>(queue.size() - 1);
+        }
+        
+        T pop() override
+        {
+            if (isEmpty())
+            {
+                return T{};
+            }
+            
+            T message = std::move(queue.front());
+            queue.pop_front();
+            
+            return message;
+        }
+        
+        //==============================================================================================================
+        bool isEmpty()  const override { return queue.empty(); }
+        bool isFull()   const override { return (size() >= BufferSize); }
+        int  size()     const override { return static_cast<int>(queue.size()); }
+        int  capacity() const override { return BufferSize; }
+    
+    private:
+        std::deque<T> queue;
+    };
+    
+    //==================================================================================================================
+    template<class Buffer>
+    void testSequential(Buffer &buffer)
+    {
+        ASSERT_TRUE(buffer.isEmpty());
+        ASSERT_EQ(buffer.capacity(), 8);
+        
+        for (int i = 1; i <= buffer.capacity(); ++i)
+        {
+            ASSERT_GT(buffer.push(i), -1);
+        }
+        
+        ASSERT_TRUE (buffer.isFull());
+        ASSERT_EQ   (buffer.size(), 8);
+        ASSERT_EQ   (buffer.push(9), -1);
+        
+        for (int i = 1; i <= buffer.capacity(); ++i)
+        {
+            ASSERT_EQ(buffer.pop(), i);
+        }
+        
+        ASSERT_TRUE(buffer.isEmpty());
+        ASSERT_EQ  (buffer.size(), 0);
+        
+        // wrap around
+        for (int i = 0; i < 20; ++i)
+        {
+            ASSERT_GT(buffer.push(i), -1);
+            ASSERT_EQ(buffer.pop(),   i);
+        }
+        
+        ASSERT_TRUE(buffer.isEmpty());
+    }
+    
+    template<class Buffer>
+    void testBatched(Buffer &buffer)
+    {
+        std::vector<int> input { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        std::vector<int> output;
+        
+        // offset head and tail so that the batch will wrap around
+        ASSERT_GT(buffer.push(0), -1);
+        ASSERT_GT(buffer.push(0), -1);
+        ASSERT_EQ(buffer.pop(),    0);
+        ASSERT_EQ(buffer.pop(),    0);
+        
+        ASSERT_EQ  (buffer.pushBatch(input), 8);
+        ASSERT_TRUE(buffer.isFull());
+        ASSERT_EQ  (buffer.pushBatch(input), 0);
+        
+        ASSERT_EQ(buffer.popBatch(std::back_inserter(output), 3), 3);
+        ASSERT_EQ(buffer.size(), 5);
+        ASSERT_EQ(buffer.popBatch(std::back_inserter(output), 100), 5);
+        ASSERT_EQ(buffer.popBatch(std::back_inserter(output), 100), 0);
+        
+        ASSERT_TRUE(buffer.isEmpty());
+        ASSERT_EQ  (output, std::vector<int>({ 1, 2, 3, 4, 5, 6, 7, 8 }));
+    }
+    //==================================================================================================================
+    // endregion Testing Facilities
+    //******************************************************************************************************************
+}
+//======================================================================================================================
+// endregion Suite Setup
+//**********************************************************************************************************************
+// region Unit Tests
+//======================================================================================================================
+TEST(MessageBufferTest, TestSimpleRingBuffer)
+{
+    jaut::SimpleRingBuffer<8, int> buffer;
+    testSequential(buffer);
+}
+
+TEST(MessageBufferTest, TestSimpleRingBufferBatched)
+{
+    jaut::SimpleRingBuffer<8, int> buffer;
+    testBatched(buffer);
+}
+
+TEST(MessageBufferTest, TestUserBufferBatched)
+{
+    DequeBuffer<8, int> buffer;
+    testBatched(buffer);
+}
+
+TEST(MessageBufferTest, TestUserBufferBatchedPartial)
+{
+    DequeBuffer<3, std::unique_ptr<int>> buffer;
+    
+    std::vector<std::unique_ptr<int>> input;
+    
+    for (int i = 1; i <= 5; ++i)
+    {
+        input.emplace_back(std::make_unique<int>(i));
+    }
+    
+    // The buffer runs full in the middle of the batch, the rest of the range must not be touched
+    ASSERT_EQ(buffer.pushBatch(input), 3);
+    ASSERT_TRUE(buffer.isFull());
+    
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(input[i], nullptr);
+    }
+    
+    ASSERT_NE(input[3], nullptr);
+    ASSERT_NE(input[4], nullptr);
+    EXPECT_EQ(*input[3], 4);
+    EXPECT_EQ(*input[4], 5);
+    
+    for (int i = 1; i <= 3; ++i)
+    {
+        const std::unique_ptr<int> message = buffer.pop();
+        
+        ASSERT_NE(message, nullptr);
+        EXPECT_EQ(*message, i);
+    }
+    
+    ASSERT_TRUE(buffer.isEmpty());
+}
+
+TEST(MessageBufferTest, TestAtomicRingBuffer)
+{
+    jaut::AtomicRingBuffer<8, int> buffer;
+    testSequential(buffer);
+}
+
+TEST(MessageBufferTest, TestAtomicRingBufferBatched)
+{
+    jaut::AtomicRingBuffer<8, int> buffer;
+    testBatched(buffer);
+}
+
+TEST(MessageBufferTest, TestFastAtomicRingBuffer)
+{
+    jaut::FastAtomicRingBuffer<8, int> buffer;
+    testSequential(buffer);
+}
+
+TEST(MessageBufferTest, TestFastAtomicRingBufferBatched)
+{
+    jaut::FastAtomicRingBuffer<8, int> buffer;
+    testBatched(buffer);
+}
+
+TEST(MessageBufferTest, TestFastAtomicRingBufferConcurrent)
+{
+    constexpr int num_messages = 100000;
+    
+    jaut::FastAtomicRingBuffer<16, int> buffer;
+    std::thread producer([&buffer]()
+    {
+        for (int i = 1; i <= num_messages; ++i)
+        {
+            while (buffer.push(i) < 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+    
+    for (int expected = 1; expected <= num_messages;)
+    {
+        if (buffer.isEmpty())
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        
+        ASSERT_EQ(buffer.pop(), expected++);
+    }
+    
+    producer.join();
+    ASSERT_TRUE(buffer.isEmpty());
+}
+
+TEST(MessageBufferTest, TestMpscRingBuffer)
+{
+    jaut::MpscRingBuffer<8, int> buffer;
+    testSequential(buffer);
+}
+
+TEST(MessageBufferTest, TestMpscRingBufferBatched)
+{
+    jaut::MpscRingBuffer<8, int> buffer;
+    testBatched(buffer);
+}
+
+TEST(MessageBufferTest, TestMpscRingBufferConcurrent)
+{
+    constexpr int num_producers = 8;
+    constexpr int num_messages  = 10000;
+    constexpr int producer_step = 1000000;
+    
+    jaut::MpscRingBuffer<64, int> buffer;
+    std::vector<std::thread>      producers;
+    
+    for (int p = 0; p < num_producers; ++p)
+    {
+        producers.emplace_back([&buffer, p]()
+        {
+            for (int i = 1; i <= num_messages; ++i)
+            {
+                // every second producer pushes in batches
+                if ((p % 2) == 1 && i <= (num_messages - 3))
+                {
+                    std::vector<int> batch { p * producer_step + i,     p * producer_step + i + 1,
+                                             p * producer_step + i + 2, p * producer_step + i + 3 };
+                    int pushed = 0;
+                    
+                    while ((pushed = buffer.pushBatch(batch)) == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                    
+                    i += (pushed - 1);
+                    continue;
+                }
+                
+                while (buffer.push(p * producer_step + i) < 0)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    
+    // Messages of one producer must arrive in the order they were pushed, without any of them missing
+    std::vector<int> last_received(num_producers, 0);
+    int              received = 0;
+    
+    while (received < (num_producers * num_messages))
+    {
+        std::vector<int> values;
+        
+        if (buffer.popBatch(std::back_inserter(values), 16) == 0)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        
+        for (const int value : values)
+        {
+            const int producer = value / producer_step;
+            const int message  = value % producer_step;
+            
+            ASSERT_EQ(message, last_received[static_cast<std::size_t>(producer)] + 1);
+            
+            last_received[static_cast<std::size_t>(producer)] = message;
+            ++received;
+        }
+    }
+    
+    for (std::thread &producer : producers)
+    {
+        producer.join();
+    }
+    
+    ASSERT_TRUE(buffer.isEmpty());
+}
+//======================================================================================================================
+// endregion Unit Tests
+//**********************************************************************************************************************